@@ -0,0 +1,334 @@
+// Micro-benchmarks for the numerical kernels in this project, using Google Benchmark
+// (https://github.com/google/benchmark).  Each benchmark sweeps its problem size, and the
+// Monte Carlo pricer also the number of worker threads.  For machine-readable results, run
+//
+//		Benchmarks --benchmark_out=results.json --benchmark_out_format=json
+//
+// (or --benchmark_format=csv), and compare runs with Google Benchmark's tools/compare.py.
+
+#include "../MonteCarloOptions/EquityPriceGenerator.h"
+#include "../MonteCarloOptions/MCEuroOptPricer.h"
+#include "../MonteCarloOptions/MCAmericanOptPricer.h"
+#include "../MonteCarloOptions/MultiAssetPriceGenerator.h"
+#include "../MonteCarloOptions/NormalGenerator.h"
+#include "../MonteCarloOptions/SdeEngine.h"
+#include "../BoostExamples/EuroTree.h"
+#include "../BoostExamples/RealFunction.h"
+#include "../BoostExamples/TimeSeries.h"
+#include "../RootFinding/Bisection.h"
+#include "../RootFinding/Steffenson.h"
+
+#include <benchmark/benchmark.h>
+#include <boost/math/quadrature/trapezoidal.hpp>
+#include <boost/math/constants/constants.hpp>
+
+#include <vector>
+#include <memory>
+#include <cmath>
+
+using std::vector;
+using qdh::root_finding::bisection;
+using qdh::root_finding::steffensonMethod;
+using boost::math::quadrature::trapezoidal;
+
+namespace
+{
+	// Market data of the examples in Main.cpp:
+	const double strike = 102.0;
+	const double spot = 100.0;
+	const double riskFreeRate = 0.025;
+	const double volatility = 0.06;
+	const double quantity = 7000.0;
+	const int initSeed = 100;
+}
+
+// NormalGenerator:  a block of 4096 standard normal variates; arg = NormalMethod
+// (0 = polar, as std::normal_distribution, 1 = ziggurat, 2 = inverse CDF)
+static void BM_NormalGeneration(benchmark::State& state)
+{
+	NormalGenerator normals(initSeed, static_cast<NormalMethod>(state.range(0)));
+	vector<double> block(4096);
+	for (auto _ : state)
+	{
+		normals(block);
+		benchmark::DoNotOptimize(block.data());
+	}
+	state.SetItemsProcessed(state.iterations() * block.size());
+}
+BENCHMARK(BM_NormalGeneration)->DenseRange(0, 2);
+
+// EquityPriceGenerator:  one path into caller-owned memory; arg = number of time steps
+static void BM_EquityPricePath(benchmark::State& state)
+{
+	unsigned numTimeSteps = static_cast<unsigned>(state.range(0));
+	EquityPriceGenerator epg(spot, numTimeSteps, 1.0, riskFreeRate, volatility);
+	vector<double> path(numTimeSteps + 1);
+	int seed = 0;
+	for (auto _ : state)
+	{
+		epg(++seed, path);
+		benchmark::DoNotOptimize(path.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * numTimeSteps);		// Time steps per second
+}
+BENCHMARK(BM_EquityPricePath)->RangeMultiplier(10)->Range(12, 12000);
+
+// EquityPriceGenerator:  terminal prices of a block of 4096 counter-based paths; arg = number of time steps
+static void BM_EquityTerminalPrices(benchmark::State& state)
+{
+	unsigned numTimeSteps = static_cast<unsigned>(state.range(0));
+	const int blockSize = 4096;
+	EquityPriceGenerator epg(spot, numTimeSteps, 1.0, riskFreeRate, volatility);
+	CounterBasedNormals rng(initSeed);
+	vector<double> prices(blockSize);
+	int firstScenario = 0;
+	for (auto _ : state)
+	{
+		epg.terminalPrices(rng, firstScenario, prices, false);
+		firstScenario += blockSize;
+		benchmark::DoNotOptimize(prices.data());
+	}
+	state.SetItemsProcessed(state.iterations() * blockSize * numTimeSteps);
+}
+BENCHMARK(BM_EquityTerminalPrices)->RangeMultiplier(10)->Range(12, 1200);
+
+// As BM_EquityTerminalPrices, with single-precision variates and paths
+static void BM_EquityTerminalPricesSingle(benchmark::State& state)
+{
+	unsigned numTimeSteps = static_cast<unsigned>(state.range(0));
+	const int blockSize = 4096;
+	EquityPriceGenerator epg(spot, numTimeSteps, 1.0, riskFreeRate, volatility);
+	CounterBasedNormals rng(initSeed);
+	vector<float> prices(blockSize);
+	int firstScenario = 0;
+	for (auto _ : state)
+	{
+		epg.terminalPrices(rng, firstScenario, std::span<float>(prices), false);
+		firstScenario += blockSize;
+		benchmark::DoNotOptimize(prices.data());
+	}
+	state.SetItemsProcessed(state.iterations() * blockSize * numTimeSteps);
+}
+BENCHMARK(BM_EquityTerminalPricesSingle)->RangeMultiplier(10)->Range(12, 1200);
+
+// SdeEngine:  a block of 4096 Heston paths over arg time steps, with the QE scheme and,
+// for comparison, with full-truncation Euler.  Items are path steps.
+template<typename Scheme>
+static void BM_HestonTerminalPrices(benchmark::State& state)
+{
+	int numTimeSteps = static_cast<int>(state.range(0));
+	const int blockSize = 4096;
+	HestonModel model{ riskFreeRate, 0.04, 1.5, 0.04, 0.5, -0.7 };
+	SdeEngine<HestonModel, Scheme> engine(model, spot, numTimeSteps, 1.0);
+	CounterBasedNormals rng(initSeed);
+	vector<double> prices(blockSize);
+	int firstScenario = 0;
+	for (auto _ : state)
+	{
+		engine.terminalPrices(rng, firstScenario, prices);
+		firstScenario += blockSize;
+		benchmark::DoNotOptimize(prices.data());
+	}
+	state.SetItemsProcessed(state.iterations() * blockSize * numTimeSteps);
+}
+BENCHMARK_TEMPLATE(BM_HestonTerminalPrices, QuadraticExponentialScheme)->RangeMultiplier(10)->Range(12, 1200);
+BENCHMARK_TEMPLATE(BM_HestonTerminalPrices, EulerScheme)->RangeMultiplier(10)->Range(12, 1200);
+
+// As BM_EquityTerminalPrices, on a grid with piecewise-constant rate and volatility; per-step
+// coefficients come from tables, so the cost should match the constant-parameter case
+static void BM_EquityTerminalPricesTermStructure(benchmark::State& state)
+{
+	int numTimeSteps = static_cast<int>(state.range(0));
+	const int blockSize = 4096;
+	vector<double> times(numTimeSteps);
+	for (int i = 0; i < numTimeSteps; ++i)
+	{
+		times[i] = (i + 1.0) / numTimeSteps;
+	}
+	TermStructure rates({ 0.25, 0.5, 1.0 }, { 0.02, 0.025, 0.03 });
+	TermStructure vols({ 0.25, 0.5, 1.0 }, { 0.25, 0.2, 0.15 });
+	EquityPriceGenerator epg(spot, times, rates, vols);
+	CounterBasedNormals rng(initSeed);
+	vector<double> prices(blockSize);
+	int firstScenario = 0;
+	for (auto _ : state)
+	{
+		epg.terminalPrices(rng, firstScenario, prices, false);
+		firstScenario += blockSize;
+		benchmark::DoNotOptimize(prices.data());
+	}
+	state.SetItemsProcessed(state.iterations() * blockSize * numTimeSteps);
+}
+BENCHMARK(BM_EquityTerminalPricesTermStructure)->RangeMultiplier(10)->Range(12, 1200);
+
+// MultiAssetPriceGenerator:  terminal prices of a block of 4096 scenarios over 12 time steps,
+// all pairs of assets with correlation 0.3; arg = number of assets
+static void BM_MultiAssetTerminalPrices(benchmark::State& state)
+{
+	int numAssets = static_cast<int>(state.range(0));
+	const int blockSize = 4096;
+	const unsigned numTimeSteps = 12;
+	vector<double> correlation(static_cast<std::size_t>(numAssets) * numAssets, 0.3);
+	for (int a = 0; a < numAssets; ++a)
+	{
+		correlation[a * numAssets + a] = 1.0;
+	}
+	MultiAssetPriceGenerator generator(vector<double>(numAssets, spot), vector<double>(numAssets, volatility),
+		correlation, numTimeSteps, 1.0, riskFreeRate);
+	CounterBasedNormals rng(initSeed);
+	vector<double> prices(static_cast<std::size_t>(numAssets) * blockSize);
+	int firstScenario = 0;
+	for (auto _ : state)
+	{
+		generator.terminalPrices(rng, firstScenario, prices);
+		firstScenario += blockSize;
+		benchmark::DoNotOptimize(prices.data());
+	}
+	state.SetItemsProcessed(state.iterations() * blockSize * numTimeSteps * numAssets);	// Asset steps per second
+}
+BENCHMARK(BM_MultiAssetTerminalPrices)->Arg(1)->Arg(2)->Arg(10)->Arg(50)->Arg(100);
+
+// MCEuroOptPricer, not in parallel; args = number of time steps, number of scenarios
+static void BM_MCEuroOptPricerNotParallel(benchmark::State& state)
+{
+	int numTimeSteps = static_cast<int>(state.range(0));
+	int numScenarios = static_cast<int>(state.range(1));
+	for (auto _ : state)
+	{
+		MCEuroOptPricer pricer(strike, spot, riskFreeRate, volatility, 1.0, OptionType::CALL,
+			numTimeSteps, numScenarios, false, initSeed, quantity);
+		benchmark::DoNotOptimize(pricer());
+	}
+	state.SetItemsProcessed(state.iterations() * numScenarios);		// Paths per second
+}
+BENCHMARK(BM_MCEuroOptPricerNotParallel)->ArgsProduct({ {12, 120}, {10000, 100000} })
+	->Unit(benchmark::kMillisecond);
+
+// MCEuroOptPricer on the thread pool; args = number of time steps, number of scenarios, number of threads
+static void BM_MCEuroOptPricerParallel(benchmark::State& state)
+{
+	MCSettings settings;
+	settings.numThreads = static_cast<unsigned>(state.range(2));
+	int numTimeSteps = static_cast<int>(state.range(0));
+	int numScenarios = static_cast<int>(state.range(1));
+	for (auto _ : state)
+	{
+		MCEuroOptPricer pricer(strike, spot, riskFreeRate, volatility, 1.0, OptionType::CALL,
+			numTimeSteps, numScenarios, initSeed, quantity, settings);
+		benchmark::DoNotOptimize(pricer());
+	}
+	state.SetItemsProcessed(state.iterations() * numScenarios);
+	state.counters["threads"] = static_cast<double>(settings.numThreads);
+}
+BENCHMARK(BM_MCEuroOptPricerParallel)->ArgsProduct({ {12, 120}, {10000, 100000}, {1, 2, 4, 8} })
+	->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// MCAmericanOptPricer (Longstaff-Schwartz put, 50 exercise dates) on the thread pool; args =
+// number of scenarios, number of threads
+static void BM_MCAmericanOptPricer(benchmark::State& state)
+{
+	MCSettings settings;
+	settings.numThreads = static_cast<unsigned>(state.range(1));
+	int numScenarios = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		MCAmericanOptPricer pricer(PutPayoff{ strike }, spot, riskFreeRate, volatility, 1.0, 50, numScenarios,
+			initSeed, quantity, RegressionSettings(), settings);
+		benchmark::DoNotOptimize(pricer());
+	}
+	state.SetItemsProcessed(state.iterations() * numScenarios);
+	state.counters["threads"] = static_cast<double>(settings.numThreads);
+}
+BENCHMARK(BM_MCAmericanOptPricer)->ArgsProduct({ {10000, 100000}, {1, 4} })
+	->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// EuroTree (binomial lattice); arg = number of time points
+static void BM_EuroTree(benchmark::State& state)
+{
+	int numTimePoints = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		EuroTree tree(spot, riskFreeRate, volatility, 0.0, strike, 1.0, Porc::CALL, numTimePoints);
+		benchmark::DoNotOptimize(tree.optionPrice());
+	}
+	state.SetComplexityN(numTimePoints);
+}
+BENCHMARK(BM_EuroTree)->RangeMultiplier(2)->Range(50, 1600)->Complexity(benchmark::oNSquared);
+
+// Root finding on the cubic of RootFindingExamples.cpp; arg = -log10(tolerance)
+static void BM_Bisection(benchmark::State& state)
+{
+	double tol = std::pow(10.0, -static_cast<double>(state.range(0)));
+	BoostCubic cubic(1.0, -2.0, -5.0, 6.0);		// Roots -2, 1 and 3
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(bisection(cubic, 2.0, 4.5, tol, 1000));
+	}
+}
+BENCHMARK(BM_Bisection)->DenseRange(4, 10, 3);
+
+// Steffenson is limited to tolerances of 1e-10 here:  below about 1e-11 the iterate lands
+// exactly on the root, the next update is 0/0, and the method runs to maxIterations.
+static void BM_Steffenson(benchmark::State& state)
+{
+	double tol = std::pow(10.0, -static_cast<double>(state.range(0)));
+	BoostCubic cubic(1.0, -2.0, -5.0, 6.0);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(steffensonMethod(cubic, 3.2, tol));
+	}
+}
+BENCHMARK(BM_Steffenson)->DenseRange(4, 10, 3);
+
+// Boost trapezoidal rule over a RealFunction, called through the base class as in
+// IntegrationAndDifferentiation.cpp; arg = -log10(tolerance)
+static void BM_TrapezoidalRealFunction(benchmark::State& state)
+{
+	double tol = std::pow(10.0, -static_cast<double>(state.range(0)));
+	std::unique_ptr<RealFunction> f = std::make_unique<SineFunction>(1.0, 1.0, 0.0);
+	auto g = [&f](double x)
+	{
+		return (*f)(x);
+	};
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(trapezoidal(g, 0.0, 0.5 * boost::math::double_constants::pi, tol, 25));
+	}
+}
+BENCHMARK(BM_TrapezoidalRealFunction)->DenseRange(4, 10, 3);
+
+// TimeSeries::movingAverage over the most recent half of the series; arg = series length
+static void BM_TimeSeriesMovingAverage(benchmark::State& state)
+{
+	Unsigned length = static_cast<Unsigned>(state.range(0));
+	TimeSeries ts(length);
+	for (Unsigned k = 0; k < length; ++k)
+	{
+		ts.append(100.0 + std::sin(0.01 * k));
+	}
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ts.movingAverage(length / 2));
+	}
+	state.SetItemsProcessed(state.iterations() * (length / 2));
+}
+BENCHMARK(BM_TimeSeriesMovingAverage)->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK_MAIN();
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -21,9 +21,18 @@ using std::make_tuple;
 
 EuroTree::EuroTree(double mktPrice, double mktRate, double mktVol, double divRate, double strike,
 	double expiry, Porc porc, int numTimePoints) :mktPrice_(mktPrice), mktRate_(mktRate), mktVol_(mktVol), 
-	divRate_(divRate), strike_(strike), expiry_(expiry), porc_(porc),
-	numTimePoints_(numTimePoints)
+	divRate_(divRate), expiry_(expiry), numTimePoints_(numTimePoints)
 {
+	// Put or call is decided once here, rather than at every terminal node; each
+	// payoff gets its own instantiation of the backward induction.
+	if (porc == Porc::CALL)
+	{
+		calcPayoffs_ = [strike](EuroTree& tree) {tree.backwardInduction_(CallPayoff{ strike }); };
+	}
+	else
+	{
+		calcPayoffs_ = [strike](EuroTree& tree) {tree.backwardInduction_(PutPayoff{ strike }); };
+	}
 	calcPrice_();
 }
 
@@ -88,7 +97,7 @@ void EuroTree::calcPrice_()
 	gridSetup_();
 	paramInit_();
 	projectPrices_();
-	calcPayoffs_();
+	calcPayoffs_(*this);
 	optionPrice_ = this->operator()(0, 0).payoff;
 }
 
@@ -127,32 +136,6 @@ void EuroTree::projectPrices_()
 	}
 }
 
-void EuroTree::calcPayoffs_()
-{
-	auto payoff = [this](double underlying)
-	{
-		if (porc_ == Porc::CALL)
-			return max(underlying - strike_, 0.0);
-		else
-			return max(strike_ - underlying, 0.0);
-	};
-
-	for (auto j = numTimePoints_ - 1; j >= 0; --j)
-	{
-		for (auto i = 0; i <= j; ++i)
-		{
-			if (j == numTimePoints_ - 1)
-			{
-				grid_[i][j].payoff = payoff(grid_[i][j].underlying);
-			}
-			else
-			{
-				grid_[i][j].payoff = discFctr_ * (p_*grid_[i + 1][j + 1].payoff + (1.0 - p_)*grid_[i][j + 1].payoff);
-			}
-		}
-	}
-}
-
 /*
 	Copyright 2019 Daniel Hanson
 
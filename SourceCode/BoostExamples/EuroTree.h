@@ -3,6 +3,8 @@
 
 #include <boost/multi_array.hpp>
 #include "Node.h"
+#include "../MonteCarloOptions/Payoffs.h"
+#include <functional>
 // #include "Date.h"
 // #include "DayCount.h"
 
@@ -18,6 +20,12 @@ public:
 	EuroTree(double mktPrice, double mktRate, double mktVol, double divRate, double strike,
 		double expiry, Porc porc, int numTimePoints);	
 
+	// Any payoff policy (see Payoffs.h), such as DigitalPayoff, StraddlePayoff or a lambda, in
+	// place of the strike and put or call:
+	template<PayoffPolicy Payoff>
+	EuroTree(double mktPrice, double mktRate, double mktVol, double divRate, const Payoff& payoff,
+		double expiry, int numTimePoints);
+
 	double calcDelta(double shift);				// Save and restore mktPrice_ as part of this operation
 	double resetMktPrice(double newMktPrice);	// Reset underlying mkt price; recalculate option price and return
 	double resetMktRate(double newMktRate);		// Reset mkt risk free rate; recalculate option price and return
@@ -33,9 +41,11 @@ private:
 	double mktPrice_, mktRate_, mktVol_;		// Market prices for underlying security, risk-free rate, and volatility
 
 	// Product/Contract Data:
-	double divRate_, strike_;	
+	double divRate_;	
 	double expiry_;		// Time to expiration as a year fraction
-	Porc porc_;			// Put or Call enum class
+
+	// Runs backwardInduction_ instantiated for the payoff, chosen once by the constructor:
+	std::function<void(EuroTree&)> calcPayoffs_;
 
 	// Model Settings:
 	int numTimePoints_;
@@ -55,9 +65,38 @@ private:
 	void gridSetup_();
 	void paramInit_();			// Determine delta t, u, d, and p, a la James book
 	void projectPrices_();
-	void calcPayoffs_();
+	template<typename Payoff>
+	void backwardInduction_(Payoff payoff);	// Payoffs at expiry, discounted back to (0, 0)
 };
 
+template<PayoffPolicy Payoff>
+EuroTree::EuroTree(double mktPrice, double mktRate, double mktVol, double divRate, const Payoff& payoff,
+	double expiry, int numTimePoints) :mktPrice_(mktPrice), mktRate_(mktRate), mktVol_(mktVol),
+	divRate_(divRate), expiry_(expiry), numTimePoints_(numTimePoints)
+{
+	calcPayoffs_ = [payoff](EuroTree& tree) {tree.backwardInduction_(payoff); };
+	calcPrice_();
+}
+
+template<typename Payoff>
+void EuroTree::backwardInduction_(Payoff payoff)
+{
+	for (auto j = numTimePoints_ - 1; j >= 0; --j)
+	{
+		for (auto i = 0; i <= j; ++i)
+		{
+			if (j == numTimePoints_ - 1)
+			{
+				grid_[i][j].payoff = payoff(grid_[i][j].underlying);
+			}
+			else
+			{
+				grid_[i][j].payoff = discFctr_ * (p_*grid_[i + 1][j + 1].payoff + (1.0 - p_)*grid_[i][j + 1].payoff);
+			}
+		}
+	}
+}
+
 #endif // !EURO_TREE_H
 
 /*
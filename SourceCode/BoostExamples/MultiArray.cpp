@@ -61,6 +61,14 @@ void eurology()
 		std::cout << i << ": " << myTree(i, 3).underlying << ", " << myTree(i, 3).payoff << std::endl;
 	}
 
+	// Any payoff policy can be priced on the tree.  A straddle is worth a call plus a put:
+	EuroTree straddle(100.0, 0.10, 0.2, 0.04, StraddlePayoff{ 100.0 }, 0.5, 200);
+	EuroTree call(100.0, 0.10, 0.2, 0.04, 100.0, 0.5, Porc::CALL, 200);
+	EuroTree put(100.0, 0.10, 0.2, 0.04, 100.0, 0.5, Porc::PUT, 200);
+	EuroTree digital(100.0, 0.10, 0.2, 0.04, DigitalPayoff{ 100.0 }, 0.5, 200);
+	std::cout << std::endl << "Straddle = " << straddle.optionPrice() << " (call + put = "
+		<< call.optionPrice() + put.optionPrice() << "); digital call = " << digital.optionPrice() << std::endl;
+
 }
 
 /*
@@ -1,5 +1,8 @@
 #include "MonteCarloOptions/EquityPriceGenerator.h"
 #include "MonteCarloOptions/MCEuroOptPricer.h"
+#include "MonteCarloOptions/MCBookPricer.h"
+#include "MonteCarloOptions/MCMultiAssetPricer.h"
+#include "MonteCarloOptions/MCAmericanOptPricer.h"
 #include "ExampleFunctionsHeader.h"
 
 #include <iostream>
@@ -7,7 +10,11 @@
 #include <random>
 #include <iterator>
 #include <execution>
-#include <ctime>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <cstddef>
 
 using std::vector;
 using std::cout;
@@ -26,8 +33,24 @@ void generalNormalGenerationTest(int n, int seed, double mean, double stdDev);
 
 void equityScenarioTest(double initEquityPrice, unsigned numTimeSteps, double timeToMaturity, 
 	double riskFreeRate, double volatility, int seed);
+void termStructureScenarioTest(double initEquityPrice, int numScenarios, int seed);
 void mcOptionTestNotParallel(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
 void mcOptionTestRunParallel(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcOptionTestTerminalSampling(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcOptionTestQuasiRandom(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcOptionTestTargetError(double tau, int numTimeSteps, int maxScenarios, double targetStdError, int initSeed = 100);
+void mcOptionTestGreeks(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcBookTest(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcPayoffPolicyTest(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcPathPayoffTest(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcMultiAssetTest(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcOptionTestSharded(double tau, int numTimeSteps, int numScenarios, int numProcesses, int initSeed = 100);
+void mcOptionTestProgressive(double tau, int numTimeSteps, int maxScenarios, double goodEnough, int initSeed = 100);
+void mcRepriceLadderTest(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void mcPrecisionValidationTest(int numTimeSteps, int numScenarios, int initSeed = 100);
+void scenarioStoreTest(double tau, int numTimeSteps, int numScenarios, int initSeed = 100);
+void sdeEngineTest(int numScenarios, int initSeed = 100);
+void mcAmericanOptionTest(int numScenarios, int initSeed = 100);
 
 void transformPar(size_t n, int terms, int seed);
 void printDouble(double x);
@@ -45,9 +68,25 @@ int main()
 	double volatility = 0.06;	
 	int seed = -106;
 	equityScenarioTest(initEquityPrice, numTimeSteps, timeToMaturity, drift, volatility, seed);
+	termStructureScenarioTest(initEquityPrice, 100000, seed);
 
 	mcOptionTestNotParallel(1.0, 12, 10000);
 	mcOptionTestRunParallel(1.0, 12, 10000);
+	mcOptionTestTerminalSampling(10.0, 1200, 100000);
+	mcOptionTestQuasiRandom(1.0, 12, 10000);
+	mcOptionTestTargetError(1.0, 12, 1000000, 10.0);
+	mcOptionTestGreeks(1.0, 12, 100000);
+	mcOptionTestSharded(1.0, 12, 1000000, 4);	// Forks:  before the shared thread pools start
+	mcBookTest(1.0, 12, 100000);
+	mcPayoffPolicyTest(1.0, 12, 100000);
+	mcPathPayoffTest(1.0, 52, 100000);
+	mcMultiAssetTest(1.0, 12, 100000);
+	mcOptionTestProgressive(1.0, 12, 10000000, 30.0);
+	mcRepriceLadderTest(1.0, 12, 100000);
+	mcPrecisionValidationTest(12, 100000);
+	scenarioStoreTest(1.0, 12, 200000);
+	sdeEngineTest(100000);
+	mcAmericanOptionTest(100000);
 
 	/*mcOptionTestNotParallel(1.0, 120, 50000);
 	mcOptionTestRunParallel(1.0, 120, 50000);
@@ -116,6 +155,32 @@ void stdNormalGenerationTest(int n, int seed)
 	for_each(stdNorms.cbegin(), stdNorms.cend(), printDouble);
 	cout << endl << endl;
 
+	// The same from the block generators (other variates for the same seed):
+	NormalGenerator ziggurat(seed, NormalMethod::ZIGGURAT);
+	ziggurat(stdNorms);
+	cout << "Ziggurat:  ";
+	for_each(stdNorms.cbegin(), stdNorms.cend(), printDouble);
+	cout << endl;
+
+	NormalGenerator inverseCdf(seed, NormalMethod::INVERSE_CDF);
+	inverseCdf(stdNorms);
+	cout << "Inverse CDF:  ";
+	for_each(stdNorms.cbegin(), stdNorms.cend(), printDouble);
+	cout << endl << endl;
+
+	// Time to fill a block of 10 million variates with each method:
+	vector<double> block(10000000);
+	cout << "Seconds for " << block.size() << " variates:";
+	for (auto [method, name] : { std::pair(NormalMethod::POLAR, "polar"), std::pair(NormalMethod::ZIGGURAT, "ziggurat"),
+		std::pair(NormalMethod::INVERSE_CDF, "inverse CDF") })
+	{
+		NormalGenerator normals(seed, method);
+		auto begin = std::chrono::steady_clock::now();
+		normals(block);
+		cout << "  " << name << " = " << std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+	cout << endl << endl;
+
 }
 
 void generalNormalGenerationTest(int n, int seed, double mean, double stdDev)
@@ -147,6 +212,38 @@ void equityScenarioTest(double initEquityPrice, unsigned numTimeSteps, double ti
 	cout << endl << endl;
 }
 
+void termStructureScenarioTest(double initEquityPrice, int numScenarios, int seed)
+{
+	cout << endl << "-----  termStructureScenarioTest(.), seed = " << seed << " -----" << endl;
+
+	// Irregular grid (e.g. from a schedule of dates), with piecewise-constant short rate and volatility:
+	vector<double> times{ 0.1, 0.25, 0.5, 0.75, 1.0, 1.5, 2.0 };
+	TermStructure rates({ 0.5, 1.0, 2.0 }, { 0.01, 0.02, 0.03 });
+	TermStructure vols({ 0.25, 1.0, 2.0 }, { 0.30, 0.20, 0.15 });
+	EquityPriceGenerator epg(initEquityPrice, times, rates, vols);
+
+	vector<double> synPrices = epg(seed);
+	for_each(synPrices.begin(), synPrices.end(), printDouble);
+	cout << endl;
+
+	// The discounted mean of S(T) should be close to S(0), and the std dev of log S(T)
+	// to the square root of the integrated variance:
+	double expiry = times.back();
+	vector<double> prices(numScenarios);
+	epg.terminalPrices(CounterBasedNormals(seed), 0, prices, false);
+	double sum = 0.0, sumLog = 0.0, sumLogSq = 0.0;
+	for (double price : prices)
+	{
+		sum += price;
+		sumLog += std::log(price);
+		sumLogSq += std::log(price) * std::log(price);
+	}
+	double meanLog = sumLog / numScenarios;
+	cout << "Discounted mean of S(T) = " << std::exp(-rates.integral(0.0, expiry)) * sum / numScenarios
+		<< "; std dev of log S(T) = " << std::sqrt(sumLogSq / numScenarios - meanLog * meanLog)
+		<< " (exact " << std::sqrt(vols.integralOfSquare(0.0, expiry)) << ")" << endl << endl;
+}
+
 void mcOptionTestNotParallel(double tau, int numTimeSteps, int numScenarios, int initSeed)
 {
 	cout << endl << "--- mcOptionTestNotParallel(tau = " << tau 
@@ -187,23 +284,552 @@ void mcOptionTestRunParallel(double tau, int numTimeSteps, int numScenarios, int
 	
 	double res = qlCall();
 	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
-	cout << "Runtime (IS RUN in parallel) = " << qlCall.time() << "; price = " << res << endl << endl;
+	cout << "Runtime (IS RUN in parallel) = " << qlCall.time() << "; price = " << res << endl;
+	cout << "Run statistics: " << qlCall.stats().toJson() << endl << endl;
+}
+
+void mcOptionTestTerminalSampling(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcOptionTestTerminalSampling(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// A European payoff only needs S(T), which can be sampled exactly in one step,
+	// so the run time here does not depend on numTimeSteps:
+	MCSettings settings;
+	settings.terminalSampling = true;
+
+	MCEuroOptPricer qlCall(strike, spot, riskFreeRate, volatility, tau,
+		OptionType::CALL, numTimeSteps, numScenarios, initSeed, quantity, settings);
+
+	double res = qlCall();
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Runtime (terminal sampling) = " << qlCall.time() << "; price = " << res << endl << endl;
+}
+
+void mcOptionTestQuasiRandom(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcOptionTestQuasiRandom(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Sobol points with Brownian bridge paths, in 16 randomly shifted replications
+	// so that the standard error of the price can still be estimated:
+	MCSettings settings;
+	settings.sampling = SamplingScheme::SCRAMBLED_SOBOL;
+	settings.numReplications = 16;
+
+	MCEuroOptPricer qlCall(strike, spot, riskFreeRate, volatility, tau,
+		OptionType::CALL, numTimeSteps, numScenarios, initSeed, quantity, settings);
+
+	double res = qlCall();
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Runtime (scrambled Sobol) = " << qlCall.time() << "; price = " << res
+		<< "; std error = " << qlCall.stdError() << endl;
+
+	// Unshifted Sobol points start after the origin, whose variates would all be about -6.4.
+	// The first point is 1/2 in every dimension, so the first scenario is the median path:
+	MCSettings plainSettings;
+	plainSettings.sampling = SamplingScheme::SOBOL;
+	MCEuroOptPricer plainCall(strike, spot, riskFreeRate, volatility, tau,
+		OptionType::CALL, numTimeSteps, numScenarios, initSeed, quantity, plainSettings);
+	MCEuroOptPricer firstScenario(0.0, spot, riskFreeRate, volatility, tau,
+		OptionType::CALL, numTimeSteps, 1, initSeed, 1.0, plainSettings);
+	double medianPrice = spot * std::exp((riskFreeRate - 0.5 * volatility * volatility) * tau);
+	cout << "Price (plain Sobol) = " << plainCall() << "; S(T) of first scenario = "
+		<< firstScenario() * std::exp(riskFreeRate * tau) << " (median S(T) = " << medianPrice << ")" << endl << endl;
+}
+
+void mcOptionTestTargetError(double tau, int numTimeSteps, int maxScenarios, double targetStdError, int initSeed)
+{
+	cout << endl << "--- mcOptionTestTargetError(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Antithetic paths plus the discounted terminal price as a control variate;
+	// scenarios are added until the standard error falls to targetStdError:
+	MCSettings settings;
+	settings.antithetic = true;
+	settings.controlVariate = true;
+	settings.targetStdError = targetStdError;
+
+	MCEuroOptPricer qlCall(strike, spot, riskFreeRate, volatility, tau,
+		OptionType::CALL, numTimeSteps, maxScenarios, initSeed, quantity, settings);
+
+	double res = qlCall();
+	cout << "Number of time steps = " << numTimeSteps << "; scenarios used = " << qlCall.scenariosUsed()
+		<< " of at most " << maxScenarios << endl;
+	ConfidenceInterval ci = qlCall.confidenceInterval(0.95);
+	cout << "Runtime (variance reduction) = " << qlCall.time() << "; price = " << res
+		<< "; std error = " << qlCall.stdError() << endl;
+	cout << "95% confidence interval = [" << ci.lower << ", " << ci.upper << "]" << endl << endl;
+}
+
+void mcOptionTestGreeks(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcOptionTestGreeks(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Price and Greeks from one simulation, rather than one per bumped input:
+	MCSettings settings;
+	settings.antithetic = true;
+	settings.computeGreeks = true;
+
+	MCEuroOptPricer qlCall(strike, spot, riskFreeRate, volatility, tau,
+		OptionType::CALL, numTimeSteps, numScenarios, initSeed, quantity, settings);
+
+	const MCGreeks& greeks = qlCall.greeks();
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Runtime (price and Greeks) = " << qlCall.time() << "; price = " << qlCall() << endl;
+	cout << "delta = " << greeks.delta.value << " (" << greeks.delta.stdError << ")"
+		<< "; gamma = " << greeks.gamma.value << " (" << greeks.gamma.stdError << ")" << endl;
+	cout << "vega = " << greeks.vega.value << " (" << greeks.vega.stdError << ")"
+		<< "; rho = " << greeks.rho.value << " (" << greeks.rho.stdError << ")" << endl << endl;
+}
+
+void mcBookTest(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcBookTest(.) ---" << endl;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+
+	// A chain of calls and puts struck from 90 to 110, priced on one set of paths:
+	vector<OptionPosition> positions;
+	for (int k = 90; k <= 110; k += 2)
+	{
+		positions.push_back({ double(k), OptionType::CALL, 7000.0 });
+		positions.push_back({ double(k), OptionType::PUT, -3000.0 });
+	}
+
+	MCBookPricer book(positions, spot, riskFreeRate, volatility, tau, numTimeSteps, numScenarios, initSeed);
+
+	cout << "Number of positions = " << book.numPositions() << "; number of scenarios = " << numScenarios << endl;
+	for (int i = 0; i < book.numPositions(); i += 10)
+	{
+		cout << "Position " << i << ": price = " << book.price(i) << " (" << book.stdError(i) << ")" << endl;
+	}
+	cout << "Runtime (whole book) = " << book.time() << "; book value = " << book.bookValue()
+		<< " (" << book.bookStdError() << ")" << endl << endl;
+}
+
+void mcPayoffPolicyTest(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcPayoffPolicyTest(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Payoffs are function objects resolved at compile time; a lambda works as well:
+	MCEuroOptPricer digital(DigitalPayoff{ strike }, spot, riskFreeRate, volatility, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+	MCEuroOptPricer straddle(StraddlePayoff{ strike }, spot, riskFreeRate, volatility, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+	auto capped = [strike](double s) {return std::min(std::max(s - strike, 0.0), 5.0); };
+	MCEuroOptPricer cappedCall(capped, spot, riskFreeRate, volatility, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Digital call = " << digital() << "; straddle = " << straddle()
+		<< "; call capped at 5 = " << cappedCall() << endl << endl;
+}
+
+void mcPathPayoffTest(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcPathPayoffTest(.) ---" << endl;
+	double strike = 100.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.2;
+	double quantity = 1.0;
+	double barrier = 90.0;
+
+	// Path-dependent payoffs observe each time step; the paths are never stored:
+	MCEuroOptPricer asian(AsianPayoff{ strike }, spot, riskFreeRate, volatility, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+	MCEuroOptPricer downAndOut(BarrierPayoff{ strike, barrier, BarrierType::DOWN_AND_OUT }, spot,
+		riskFreeRate, volatility, tau, numTimeSteps, numScenarios, initSeed, quantity);
+	MCEuroOptPricer downAndOutDiscrete(BarrierPayoff{ strike, barrier, BarrierType::DOWN_AND_OUT,
+		OptionType::CALL, false }, spot, riskFreeRate, volatility, tau, numTimeSteps, numScenarios, initSeed, quantity);
+	MCEuroOptPricer lookback(FloatingStrikeLookbackPayoff{ OptionType::CALL }, spot, riskFreeRate, volatility, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Asian call = " << asian() << "; floating strike lookback call = " << lookback() << endl;
+	cout << "Down-and-out call, barrier " << barrier << ":  continuous = " << downAndOut()
+		<< " (+/- " << downAndOut.stdError() << "); monitored at the time steps only = "
+		<< downAndOutDiscrete() << endl << endl;
+}
+
+void mcMultiAssetTest(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcMultiAssetTest(.) ---" << endl;
+	double riskFreeRate = 0.025;
+	double quantity = 1.0;
+
+	// Option to exchange asset 1 for asset 0 (Margrabe:  12.952):
+	vector<double> spots{ 100.0, 95.0 };
+	vector<double> vols{ 0.3, 0.2 };
+	vector<double> correlation{ 1.0, 0.5, 0.5, 1.0 };
+	MCMultiAssetPricer exchange(SpreadPayoff{ 0.0 }, spots, vols, correlation, riskFreeRate, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+
+	// Equally weighted basket call on 20 assets, pairwise correlation 0.3:
+	const int numAssets = 20;
+	vector<double> basketCorrelation(numAssets * numAssets, 0.3);
+	for (int a = 0; a < numAssets; ++a)
+	{
+		basketCorrelation[a * numAssets + a] = 1.0;
+	}
+	MCMultiAssetPricer basket(BasketPayoff{ vector<double>(numAssets, 1.0 / numAssets), 100.0 },
+		vector<double>(numAssets, 100.0), vector<double>(numAssets, 0.2), basketCorrelation, riskFreeRate, tau,
+		numTimeSteps, numScenarios, initSeed, quantity);
+
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Exchange option = " << exchange() << " (+/- " << exchange.stdError() << ")" << endl;
+	cout << numAssets << "-asset basket call = " << basket() << " (+/- " << basket.stdError()
+		<< "); runtime = " << basket.time() << endl << endl;
+}
+
+void mcOptionTestSharded(double tau, int numTimeSteps, int numScenarios, int numProcesses, int initSeed)
+{
+	cout << endl << "--- mcOptionTestSharded(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Worker processes are only forked from a process with no other threads, so the
+	// reference run is serial and leaves no thread pool behind:
+	MCSettings settings;
+	settings.antithetic = true;
+	settings.controlVariate = true;
+	settings.runParallel = false;
+	MCEuroOptPricer single(strike, spot, riskFreeRate, volatility, tau, OptionType::CALL,
+		numTimeSteps, numScenarios, initSeed, quantity, settings);
+
+	// The same job split across worker processes:
+	settings.numProcesses = numProcesses;
+	try
+	{
+		MCEuroOptPricer sharded(strike, spot, riskFreeRate, volatility, tau, OptionType::CALL,
+			numTimeSteps, numScenarios, initSeed, quantity, settings);
+		cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+		cout << "One process:  price = " << single() << "; runtime = " << single.time() << endl;
+		cout << numProcesses << " processes:  price = " << sharded() << "; runtime = " << sharded.time()
+			<< "; bit-identical = " << std::boolalpha << (sharded() == single() && sharded.stdError() == single.stdError())
+			<< endl << endl;
+	}
+	catch (const std::exception& e)
+	{
+		cout << e.what() << endl << endl;
+	}
+}
+
+void mcOptionTestProgressive(double tau, int numTimeSteps, int maxScenarios, double goodEnough, int initSeed)
+{
+	cout << endl << "--- mcOptionTestProgressive(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Report the running estimate every 16 blocks, and stop once the standard error is good enough:
+	MCSettings settings;
+	settings.blocksPerCheck = 16;
+	settings.onProgress = [goodEnough](const ProgressUpdate& update)
+	{
+		cout << "  " << update.scenariosDone << " scenarios:  price = " << update.price
+			<< " (+/- " << update.stdError << ")" << endl;
+		return update.stdError > goodEnough;
+	};
+	MCEuroOptPricer qlCall(strike, spot, riskFreeRate, volatility, tau, OptionType::CALL,
+		numTimeSteps, maxScenarios, initSeed, quantity, settings);
+
+	cout << "Price = " << qlCall() << "; scenarios used = " << qlCall.scenariosUsed() << " of " << maxScenarios
+		<< "; cancelled = " << std::boolalpha << qlCall.cancelled() << endl << endl;
+}
+
+void mcRepriceLadderTest(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcRepriceLadderTest(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+	double bump = 1.0;
+
+	// Spot ladder, repriced from the cached W(T) of the first run.  The arenas draw their
+	// memory through a counting resource, so the allocations of each run are reported:
+	CountingResource allocationCounter;
+	MCSettings settings;
+	settings.variateCache = VariateCache::TERMINAL;
+	settings.memoryResource = &allocationCounter;
+	MCEuroOptPricer qlCall(strike, spot, riskFreeRate, volatility, tau, OptionType::CALL,
+		numTimeSteps, numScenarios, initSeed, quantity, settings);
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Base price = " << qlCall() << " (+/- " << qlCall.stdError() << "); runtime = " << qlCall.time() << endl;
+	double repriceTime = 0.0;
+	for (double ladderSpot = 90.0; ladderSpot <= 110.0; ladderSpot += 5.0)
+	{
+		MarketInputs inputs = qlCall.marketInputs();
+		inputs.spot = ladderSpot;
+		qlCall.reprice(inputs);
+		repriceTime += qlCall.time();
+		cout << "  spot = " << ladderSpot << ":  price = " << qlCall() << endl;
+	}
+	cout << "Mean runtime per reprice = " << repriceTime / 5.0 << endl;
+	cout << "Arena allocations in last reprice = " << qlCall.stats().allocations
+		<< "; peak scratch bytes = " << qlCall.stats().peakBytes << endl;
+
+	// Central-difference delta with common random numbers, and from independent runs:
+	MarketInputs inputs = qlCall.marketInputs();
+	inputs.spot = spot + bump;
+	double up = qlCall.reprice(inputs);
+	inputs.spot = spot - bump;
+	double down = qlCall.reprice(inputs);
+	MCEuroOptPricer upIndependent(strike, spot + bump, riskFreeRate, volatility, tau, OptionType::CALL,
+		numTimeSteps, numScenarios, initSeed + 1, quantity, settings);
+	MCEuroOptPricer downIndependent(strike, spot - bump, riskFreeRate, volatility, tau, OptionType::CALL,
+		numTimeSteps, numScenarios, initSeed + 2, quantity, settings);
+	cout << "Delta, common random numbers = " << (up - down) / (2.0 * bump)
+		<< "; independent runs = " << (upIndependent() - downIndependent()) / (2.0 * bump) << endl << endl;
+}
+
+// Validation report for single-precision paths:  float and double prices of a reference set of
+// calls and puts, from the same scenarios.  The differences are reported in units of the
+// standard error, and should be far below 1.
+void mcPrecisionValidationTest(int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcPrecisionValidationTest(.) ---" << endl;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double quantity = 1.0;
+
+	MCSettings doubleSettings;
+	doubleSettings.runParallel = false;
+	MCSettings floatSettings = doubleSettings;
+	floatSettings.pathPrecision = PathPrecision::SINGLE;
+
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	double maxRatio = 0.0;
+	double doubleTime = 0.0;
+	double floatTime = 0.0;
+	for (OptionType optionType : { OptionType::CALL, OptionType::PUT })
+	{
+		for (double strike : { 80.0, 100.0, 120.0 })
+		{
+			for (double volatility : { 0.1, 0.3 })
+			{
+				for (double tau : { 0.25, 5.0 })
+				{
+					MCEuroOptPricer doublePricer(strike, spot, riskFreeRate, volatility, tau, optionType,
+						numTimeSteps, numScenarios, initSeed, quantity, doubleSettings);
+					MCEuroOptPricer floatPricer(strike, spot, riskFreeRate, volatility, tau, optionType,
+						numTimeSteps, numScenarios, initSeed, quantity, floatSettings);
+					double difference = std::abs(floatPricer() - doublePricer());
+					double ratio = (difference == 0.0) ? 0.0 : difference / doublePricer.stdError();
+					maxRatio = std::max(maxRatio, ratio);
+					doubleTime += doublePricer.time();
+					floatTime += floatPricer.time();
+					cout << "  " << (optionType == OptionType::CALL ? "call" : "put ") << " K = " << strike
+						<< ", vol = " << volatility << ", T = " << tau << ":  double = " << doublePricer()
+						<< ", float = " << floatPricer() << ", |difference| / stdError = " << ratio << endl;
+				}
+			}
+		}
+	}
+	cout << "Largest |difference| / stdError = " << maxRatio << endl;
+	cout << "Total runtime:  double = " << doubleTime << "; float = " << floatTime << endl << endl;
+}
+
+void scenarioStoreTest(double tau, int numTimeSteps, int numScenarios, int initSeed)
+{
+	cout << endl << "--- scenarioStoreTest(.) ---" << endl;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.06;
+	double quantity = 7000.00;
+
+	// Simulate once, and write the paths to a store:
+	std::string fileName = (std::filesystem::temp_directory_path() / "CppCon2019Scenarios.mcs").string();
+	EquityPriceGenerator epg(spot, numTimeSteps, tau, riskFreeRate, volatility);
+	auto begin = std::chrono::steady_clock::now();
+	epg.writeScenarioStore(fileName, initSeed, numScenarios);
+	auto end = std::chrono::steady_clock::now();
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "Scenario store written in " << std::chrono::duration<double>(end - begin).count() << " seconds ("
+		<< std::filesystem::file_size(fileName) / (1024 * 1024) << " MB)" << endl;
+
+	// Later jobs map it and only evaluate payoffs; for comparison, the same options are
+	// simulated, with the same seed:
+	{
+		ScenarioStore store(fileName);
+		MCSettings settings;
+		double storeTime = 0.0;
+		double simulationTime = 0.0;
+		for (double strike : { 95.0, 100.0, 105.0 })
+		{
+			MCEuroOptPricer fromStore(CallPayoff{ strike }, store, quantity, settings);
+			MCEuroOptPricer simulated(CallPayoff{ strike }, spot, riskFreeRate, volatility, tau,
+				numTimeSteps, numScenarios, initSeed, quantity, settings);
+			storeTime += fromStore.time();
+			simulationTime += simulated.time();
+			cout << "  call K = " << strike << ":  from store = " << fromStore() << "; simulated = " << simulated() << endl;
+		}
+		MCEuroOptPricer asian(AsianPayoff{ 100.0, OptionType::CALL }, store, quantity, settings);
+		cout << "  Asian call K = 100 from the stored paths = " << asian() << endl;
+		cout << "Total runtime of the calls:  from store = " << storeTime << "; simulated = " << simulationTime << endl;
+	}
+
+	// A header whose counts do not fit the file is rejected, even where the data size they
+	// imply would overflow 64 bits:
+	{
+		std::fstream file(fileName, std::ios::in | std::ios::out | std::ios::binary);
+		std::int64_t numStoredScenarios = INT32_MAX;
+		file.seekp(offsetof(ScenarioStoreHeader, numScenarios));
+		file.write(reinterpret_cast<const char*>(&numStoredScenarios), sizeof(numStoredScenarios));
+	}
+	try
+	{
+		ScenarioStore corrupt(fileName);
+		cout << "Corrupt store was accepted" << endl << endl;
+	}
+	catch (const std::exception& e)
+	{
+		cout << "Corrupt store rejected:  " << e.what() << endl << endl;
+	}
+	std::filesystem::remove(fileName);
+}
+
+// The same call under several models and discretization schemes of SdeEngine.h, all priced
+// by MCEuroOptPricer on its usual blocks and threads:
+void sdeEngineTest(int numScenarios, int initSeed)
+{
+	cout << endl << "--- sdeEngineTest(.) ---" << endl;
+	double strike = 102.0;
+	double spot = 100.0;
+	double riskFreeRate = 0.025;
+	double volatility = 0.2;
+	double tau = 1.0;
+	int numTimeSteps = 12;
+	double quantity = 1.0;
+	MCSettings settings;
+
+	// GBM:  the exact scheme reproduces EquityPriceGenerator; Euler and Milstein add their bias.
+	MCEuroOptPricer gbm(strike, spot, riskFreeRate, volatility, tau, OptionType::CALL,
+		numTimeSteps, numScenarios, initSeed, quantity, settings);
+	GbmModel gbmModel{ riskFreeRate, volatility };
+	MCEuroOptPricer exact(CallPayoff{ strike }, SdeEngine<GbmModel, ExactGbmScheme>(gbmModel, spot, numTimeSteps, tau),
+		numScenarios, initSeed, quantity, settings);
+	MCEuroOptPricer euler(CallPayoff{ strike }, SdeEngine<GbmModel, EulerScheme>(gbmModel, spot, numTimeSteps, tau),
+		numScenarios, initSeed, quantity, settings);
+	MCEuroOptPricer milstein(CallPayoff{ strike }, SdeEngine<GbmModel, MilsteinScheme>(gbmModel, spot, numTimeSteps, tau),
+		numScenarios, initSeed, quantity, settings);
+	cout << "Number of time steps = " << numTimeSteps << "; number of scenarios = " << numScenarios << endl;
+	cout << "GBM call:  EquityPriceGenerator = " << gbm() << "; exact = " << exact() << "; Euler = " << euler()
+		<< "; Milstein = " << milstein() << " (+/- " << gbm.stdError() << ")" << endl;
+
+	// Skewed one-factor models, on a finer grid:
+	int fineSteps = 50;
+	CevModel cevModel{ riskFreeRate, volatility * std::sqrt(spot), 0.5 };
+	MCEuroOptPricer cev(CallPayoff{ strike }, SdeEngine<CevModel, MilsteinScheme>(cevModel, spot, fineSteps, tau),
+		numScenarios, initSeed, quantity, settings);
+	LocalVolModel localVolModel{ riskFreeRate, [](double, double s) { return 0.2 * std::pow(s / 100.0, -0.3); } };
+	MCEuroOptPricer localVol(CallPayoff{ strike },
+		SdeEngine<decltype(localVolModel), MilsteinScheme>(localVolModel, spot, fineSteps, tau),
+		numScenarios, initSeed, quantity, settings);
+	cout << "Milstein, " << fineSteps << " steps:  CEV (beta = 0.5) call = " << cev() << "; local volatility call = "
+		<< localVol() << endl;
+
+	// Heston, Andersen's (2008) case I:  r = 0, T = 10, K = 100, with reference price 13.0847.
+	HestonModel hestonModel{ 0.0, 0.04, 0.5, 0.04, 1.0, -0.9 };
+	for (int hestonSteps : { 10, 80 })
+	{
+		MCEuroOptPricer qe(CallPayoff{ 100.0 },
+			SdeEngine<HestonModel, QuadraticExponentialScheme>(hestonModel, spot, hestonSteps, 10.0),
+			numScenarios, initSeed, quantity, settings);
+		MCEuroOptPricer hestonEuler(CallPayoff{ 100.0 },
+			SdeEngine<HestonModel, EulerScheme>(hestonModel, spot, hestonSteps, 10.0),
+			numScenarios, initSeed, quantity, settings);
+		cout << "Heston call, " << hestonSteps << " steps:  QE = " << qe() << " (+/- " << qe.stdError()
+			<< "); Euler = " << hestonEuler() << " (+/- " << hestonEuler.stdError() << "); reference = 13.0847" << endl;
+	}
+	cout << endl;
+}
+
+// Least-squares Monte Carlo:  American puts from Table 1 of Longstaff and Schwartz (2001),
+// with 50 exercise dates a year (K = 40, r = 0.06; finite-difference values for reference),
+// and an American put on a two-asset basket against its European counterpart.
+void mcAmericanOptionTest(int numScenarios, int initSeed)
+{
+	cout << endl << "--- mcAmericanOptionTest(.) ---" << endl;
+	double strike = 40.0;
+	double riskFreeRate = 0.06;
+	double quantity = 1.0;
+
+	struct TestCase
+	{
+		double spot;
+		double volatility;
+		double tau;
+		double reference;
+	};
+	cout << "Number of scenarios = " << numScenarios << endl;
+	for (const TestCase& test : { TestCase{ 36.0, 0.2, 1.0, 4.478 }, TestCase{ 40.0, 0.2, 1.0, 2.314 },
+		TestCase{ 44.0, 0.2, 1.0, 1.110 }, TestCase{ 36.0, 0.4, 2.0, 8.508 } })
+	{
+		int numTimeSteps = static_cast<int>(50 * test.tau);
+		MCAmericanOptPricer put(PutPayoff{ strike }, test.spot, riskFreeRate, test.volatility, test.tau,
+			numTimeSteps, numScenarios, initSeed, quantity);
+		cout << "  S = " << test.spot << ", sigma = " << test.volatility << ", T = " << test.tau << ":  LSM = " << put()
+			<< " (+/- " << put.stdError() << "); finite difference = " << test.reference
+			<< "; exercised early = " << put.earlyExerciseFraction() << endl;
+	}
+
+	// Basket put, regressed on x, x^2 of each asset and the payoff:
+	vector<double> spots{ 100.0, 100.0 };
+	vector<double> vols{ 0.2, 0.3 };
+	vector<double> correlation{ 1.0, 0.5, 0.5, 1.0 };
+	BasketPayoff basketPut{ { 0.5, 0.5 }, 100.0, OptionType::PUT };
+	RegressionSettings regression;
+	regression.degree = 2;
+	regression.payoffInBasis = true;
+	MCAmericanOptPricer american(basketPut, spots, vols, correlation, riskFreeRate, 1.0, 50, numScenarios,
+		initSeed, quantity, regression);
+	MCMultiAssetPricer european(basketPut, spots, vols, correlation, riskFreeRate, 1.0, 50, numScenarios,
+		initSeed, quantity);
+	cout << "Basket put:  American = " << american() << " (+/- " << american.stdError() << "); European = "
+		<< european() << " (+/- " << european.stdError() << "); runtime = " << american.time() << endl << endl;
 }
 
 // For testing parallel STL algorithm transform(.):
 void transformPar(size_t n, int terms, int seed)
 {
 	cout << endl << "--- transformPar(.) ---" << endl;
-	std::mt19937_64 mtre(seed);
-	std::normal_distribution<> nd;
 	vector<double> v(n);
 
-	auto nextNorm = [&mtre, &nd](double x)
-	{
-		return nd(mtre);
-	};
-
-	std::transform(v.begin(), v.end(), v.begin(), nextNorm);
+	// The variates are filled as one block, by the ziggurat:
+	NormalGenerator normals(seed);
+	normals(v);
 	auto u = v;
 
 	cout << endl;
@@ -226,11 +852,12 @@ void transformPar(size_t n, int terms, int seed)
 	cout << "exp(1) = " << expSeries(1.0) << " - should = 2.71828" << endl << endl;
 	cout << "Number of elements = " << n << "; number of terms = " << terms << endl << endl;
 
-	// Use std::transform to run exponential power series on each element in v:
-	clock_t begin = clock();		// begin time with threads
+	// Use std::transform to run exponential power series on each element in v.
+	// Wall-clock time, as clock() would add up the CPU time of all threads:
+	auto begin = std::chrono::steady_clock::now();
 	std::transform(u.begin(), u.end(), u.begin(), expSeries);
-	clock_t end = clock();		// end transform time with no par
-	auto time = (end - begin) / CLOCKS_PER_SEC;
+	auto end = std::chrono::steady_clock::now();		// end transform time with no par
+	double time = std::chrono::duration<double>(end - begin).count();
 
 	auto mean = (1.0 / u.size())*std::reduce(u.cbegin(), u.cend(), 0.0);
 
@@ -241,10 +868,10 @@ void transformPar(size_t n, int terms, int seed)
 
 	// Use std::transform with std::par execution policy 
 	// to run exponential power series on each element in v:
-	begin = clock();		// begin time with threads
+	begin = std::chrono::steady_clock::now();		// begin time with threads
 	std::transform(std::execution::par, v.begin(), v.end(), v.begin(), expSeries);
-	end = clock();		// end transform time with par
-	time = (end - begin) / CLOCKS_PER_SEC;
+	end = std::chrono::steady_clock::now();		// end transform time with par
+	time = std::chrono::duration<double>(end - begin).count();
 
 	auto meanPar = (1.0 / v.size())*std::reduce(v.cbegin(), v.cend(), 0.0);
 
@@ -0,0 +1,99 @@
+#include "Arena.h"
+#include <algorithm>
+
+namespace
+{
+	constexpr std::size_t bufferAlignment = alignof(std::max_align_t);
+	constexpr std::size_t bufferGranularity = 4096;
+}
+
+Arena::Arena(std::pmr::memory_resource* upstream) :upstream_(upstream)
+{
+	monotonic_.emplace(upstream_);
+}
+
+Arena::~Arena()
+{
+	monotonic_.reset();
+	if (buffer_)
+	{
+		upstream_->deallocate(buffer_, capacity_, bufferAlignment);
+	}
+}
+
+void Arena::reset()
+{
+	if (bytesInUse_ > capacity_)
+	{
+		// The last pass overflowed into the upstream resource:  grow the buffer to fit it, with
+		// a margin for the padding the monotonic resource adds for alignment.
+		monotonic_.reset();
+		if (buffer_)
+		{
+			upstream_->deallocate(buffer_, capacity_, bufferAlignment);
+		}
+		std::size_t wanted = bytesInUse_ + bytesInUse_ / 8;
+		capacity_ = (wanted + bufferGranularity - 1) / bufferGranularity * bufferGranularity;
+		buffer_ = upstream_->allocate(capacity_, bufferAlignment);
+		monotonic_.emplace(buffer_, capacity_, upstream_);
+	}
+	else
+	{
+		monotonic_->release();
+	}
+	bytesInUse_ = 0;
+}
+
+std::size_t Arena::bytesInUse() const
+{
+	return bytesInUse_;
+}
+
+std::size_t Arena::peakBytes() const
+{
+	return peakBytes_;
+}
+
+void Arena::resetPeak()
+{
+	peakBytes_ = bytesInUse_;
+}
+
+std::size_t Arena::capacity() const
+{
+	return capacity_;
+}
+
+void* Arena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	void* p = monotonic_->allocate(bytes, alignment);
+	bytesInUse_ += bytes;
+	peakBytes_ = std::max(peakBytes_, bytesInUse_);
+	return p;
+}
+
+void Arena::do_deallocate(void*, std::size_t, std::size_t)
+{
+	// Memory is only reclaimed by reset()
+}
+
+bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,59 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <memory_resource>
+#include <optional>
+#include <cstddef>
+
+// Monotonic arena for scratch memory that is reused pass after pass, such as the buffers of
+// a block of scenarios.  Allocations are served from one buffer by a
+// std::pmr::monotonic_buffer_resource and deallocation does nothing; reset() makes the
+// whole buffer available again.  A pass that needs more than the buffer takes the excess
+// from the upstream resource, and the next reset() grows the buffer to fit that pass, so a
+// repeated workload makes no upstream calls once the buffer has grown.  Not thread-safe:
+// each thread needs its own arena.
+class Arena : public std::pmr::memory_resource
+{
+public:
+	explicit Arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+	~Arena() override;
+
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	void reset();
+	std::size_t bytesInUse() const;		// Allocated since the last reset()
+	std::size_t peakBytes() const;		// Largest bytesInUse() since construction or resetPeak()
+	void resetPeak();
+	std::size_t capacity() const;		// Size of the buffer
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	std::pmr::memory_resource* upstream_;
+	void* buffer_ = nullptr;
+	std::size_t capacity_ = 0;
+	std::size_t bytesInUse_ = 0;
+	std::size_t peakBytes_ = 0;
+	std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
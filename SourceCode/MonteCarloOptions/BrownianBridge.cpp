@@ -0,0 +1,129 @@
+#include "BrownianBridge.h"
+#include <cmath>
+#include <stdexcept>
+
+using std::vector;
+using std::sqrt;
+
+BrownianBridge::BrownianBridge(int numTimeSteps, double timeToExpiry) :times_(numTimeSteps)
+{
+	for (int i = 0; i < numTimeSteps; ++i)
+	{
+		times_[i] = timeToExpiry * (i + 1) / numTimeSteps;
+	}
+	initialize_();
+}
+
+BrownianBridge::BrownianBridge(const vector<double>& times) :times_(times)
+{
+	initialize_();
+}
+
+int BrownianBridge::size() const
+{
+	return static_cast<int>(times_.size());
+}
+
+void BrownianBridge::initialize_()
+{
+	const int n = size();
+	if (n == 0)
+	{
+		throw std::invalid_argument("BrownianBridge: at least one time step is required");
+	}
+
+	sqrtDt_.resize(n);
+	for (int i = 0; i < n; ++i)
+	{
+		double dt = times_[i] - (i > 0 ? times_[i - 1] : 0.0);
+		if (dt <= 0.0)
+		{
+			throw std::invalid_argument("BrownianBridge: times must be positive and increasing");
+		}
+		sqrtDt_[i] = sqrt(dt);
+	}
+
+	bridgeIndex_.assign(n, 0);
+	leftIndex_.assign(n, 0);
+	rightIndex_.assign(n, 0);
+	leftWeight_.assign(n, 0.0);
+	rightWeight_.assign(n, 0.0);
+	stdDev_.assign(n, 0.0);
+
+	// map[i] != 0 once W(t_i) has been fixed.  The final point comes first:
+	vector<int> map(n, 0);
+	map[n - 1] = 1;
+	bridgeIndex_[0] = n - 1;
+	stdDev_[0] = sqrt(times_[n - 1]);
+
+	for (int i = 1, j = 0; i < n; ++i)
+	{
+		// Find the next run of unfixed points j, ..., k - 1, bounded on the right by k:
+		while (map[j])
+		{
+			++j;
+		}
+		int k = j;
+		while (!map[k])
+		{
+			++k;
+		}
+
+		// Fix its midpoint l, conditional on W(t_(j-1)) and W(t_k):
+		int l = j + ((k - 1 - j) >> 1);
+		map[l] = i;
+		bridgeIndex_[i] = l;
+		leftIndex_[i] = j;
+		rightIndex_[i] = k;
+
+		double tLeft = (j > 0) ? times_[j - 1] : 0.0;
+		leftWeight_[i] = (times_[k] - times_[l]) / (times_[k] - tLeft);
+		rightWeight_[i] = (times_[l] - tLeft) / (times_[k] - tLeft);
+		stdDev_[i] = sqrt((times_[l] - tLeft) * (times_[k] - times_[l]) / (times_[k] - tLeft));
+
+		j = k + 1;
+		if (j >= n)
+		{
+			j = 0;
+		}
+	}
+}
+
+void BrownianBridge::operator()(const double* normals, double* increments) const
+{
+	const int n = size();
+
+	// Build the path W(t_1), ..., W(t_n) in increments[] first:
+	increments[n - 1] = stdDev_[0] * normals[0];
+	for (int i = 1; i < n; ++i)
+	{
+		int j = leftIndex_[i];
+		int k = rightIndex_[i];
+		int l = bridgeIndex_[i];
+		double wLeft = (j > 0) ? increments[j - 1] : 0.0;
+		increments[l] = leftWeight_[i] * wLeft + rightWeight_[i] * increments[k] + stdDev_[i] * normals[i];
+	}
+
+	// ... then difference and standardize it:
+	for (int i = n - 1; i > 0; --i)
+	{
+		increments[i] = (increments[i] - increments[i - 1]) / sqrtDt_[i];
+	}
+	increments[0] /= sqrtDt_[0];
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,48 @@
+#ifndef BROWNIAN_BRIDGE_H
+#define BROWNIAN_BRIDGE_H
+
+#include <vector>
+
+// Brownian bridge construction of a Brownian path on the grid 0 < t_1 < ... < t_n
+// (Glasserman, "Monte Carlo Methods in Financial Engineering", 3.1).  The first variate
+// fixes W(t_n), the second the midpoint, and so on, so that the leading dimensions of a
+// low-discrepancy point carry most of the variance of the path.
+class BrownianBridge
+{
+public:
+	BrownianBridge(int numTimeSteps, double timeToExpiry);		// Uniform grid t_i = i * timeToExpiry / numTimeSteps
+	explicit BrownianBridge(const std::vector<double>& times);	// t_1, ..., t_n, increasing and > 0
+
+	int size() const;
+
+	// Maps n independent standard normal variates to the standardized increments
+	// (W(t_i) - W(t_(i-1))) / sqrt(t_i - t_(i-1)), which are again independent standard
+	// normals and can be used in place of the original variates to advance a path.
+	void operator()(const double* normals, double* increments) const;
+
+private:
+	void initialize_();
+
+	std::vector<double> times_;
+	std::vector<double> sqrtDt_;
+	std::vector<int> bridgeIndex_, leftIndex_, rightIndex_;
+	std::vector<double> leftWeight_, rightWeight_, stdDev_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -1,50 +1,374 @@
 #include "EquityPriceGenerator.h"
-#include <random>
+#include "GbmKernel.h"
+#include "ScenarioStore.h"
 #include <algorithm>	
 #include <ctime>
 #include <cmath>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <fstream>
+#include <cstring>
 
 using std::vector;
-using std::mt19937_64;
-using std::normal_distribution;
 
 using std::exp;
 
 using std::vector;
 
-EquityPriceGenerator::EquityPriceGenerator(double initEquityPrice, unsigned numTimeSteps, double timeToExpiry, double drift, double volatility) :
-	initEquityPrice_(initEquityPrice), numTimeSteps_(numTimeSteps), drift_(drift), volatility_(volatility),
-	dt_(timeToExpiry/numTimeSteps) {}
+EquityPriceGenerator::EquityPriceGenerator(double initEquityPrice, unsigned numTimeSteps, double timeToExpiry, double drift, double volatility,
+	std::pmr::memory_resource* resource) :
+	initEquityPrice_(initEquityPrice), numTimeSteps_(numTimeSteps), times_(numTimeSteps + 1, resource),
+	stepDrifts_(resource), stepDiffusions_(resource)
+{
+	if (numTimeSteps == 0)
+	{
+		throw std::invalid_argument("EquityPriceGenerator: at least one time step is required");
+	}
+	double dt = timeToExpiry / numTimeSteps;
+	for (int i = 0; i <= numTimeSteps_; ++i)
+	{
+		times_[i] = i * dt;
+	}
+
+	// These do not change from one time step to the next:
+	stepDrifts_.assign(numTimeSteps_, (drift - ((volatility * volatility) / 2.0)) * dt);
+	stepDiffusions_.assign(numTimeSteps_, volatility * sqrt(dt));
+	uniformSteps_ = true;
+
+	termDrift_ = (drift - ((volatility * volatility) / 2.0)) * timeToExpiry;
+	termDiffusion_ = volatility * sqrt(timeToExpiry);
+}
+
+EquityPriceGenerator::EquityPriceGenerator(double initEquityPrice, const vector<double>& times,
+	const TermStructure& rates, const TermStructure& volatilities, std::pmr::memory_resource* resource) :
+	initEquityPrice_(initEquityPrice), numTimeSteps_(static_cast<int>(times.size())), times_(times.size() + 1, resource),
+	stepDrifts_(resource), stepDiffusions_(resource)
+{
+	if (times.empty())
+	{
+		throw std::invalid_argument("EquityPriceGenerator: at least one time step is required");
+	}
+	for (int i = 0; i < numTimeSteps_; ++i)
+	{
+		if (times[i] <= times_[i])
+		{
+			throw std::invalid_argument("EquityPriceGenerator: times must be positive and increasing");
+		}
+		times_[i + 1] = times[i];
+	}
+	initialize_(rates, volatilities);
+}
+
+void EquityPriceGenerator::initialize_(const TermStructure& rates, const TermStructure& volatilities)
+{
+	stepDrifts_.resize(numTimeSteps_);
+	stepDiffusions_.resize(numTimeSteps_);
+	for (int i = 0; i < numTimeSteps_; ++i)
+	{
+		double variance = volatilities.integralOfSquare(times_[i], times_[i + 1]);
+		stepDrifts_[i] = rates.integral(times_[i], times_[i + 1]) - variance / 2.0;
+		stepDiffusions_[i] = sqrt(variance);
+	}
+	uniformSteps_ = std::adjacent_find(stepDrifts_.begin(), stepDrifts_.end(), std::not_equal_to<>()) == stepDrifts_.end()
+		&& std::adjacent_find(stepDiffusions_.begin(), stepDiffusions_.end(), std::not_equal_to<>()) == stepDiffusions_.end();
+
+	double timeToExpiry = times_.back();
+	double variance = volatilities.integralOfSquare(0.0, timeToExpiry);
+	termDrift_ = rates.integral(0.0, timeToExpiry) - variance / 2.0;
+	termDiffusion_ = sqrt(variance);
+}
 
 vector<double> EquityPriceGenerator::operator()(int seed) const
 {
-	vector<double> v;
+	vector<double> v(numTimeSteps_ + 1);
+	fillPath_(seed, v.data());
+	return v;
+}
+
+void EquityPriceGenerator::setNormalMethod(NormalMethod method)
+{
+	normalMethod_ = method;
+}
+
+void EquityPriceGenerator::operator()(int seed, std::span<double> path) const
+{
+	if (path.size() != static_cast<std::size_t>(numTimeSteps_) + 1)
+	{
+		throw std::invalid_argument("EquityPriceGenerator: path size must equal numTimeSteps + 1");
+	}
+	fillPath_(seed, path.data());
+}
+
+void EquityPriceGenerator::operator()(int firstSeed, ScenarioMatrix& paths) const
+{
+	if (paths.numPrices() != numTimeSteps_ + 1)
+	{
+		throw std::invalid_argument("EquityPriceGenerator: ScenarioMatrix must hold numTimeSteps + 1 prices per path");
+	}
+
+	for (int k = 0; k < paths.numScenarios(); ++k)
+	{
+		NormalGenerator normals(firstSeed + k, normalMethod_);
+		for (int i = 1; i <= numTimeSteps_; ++i)
+		{
+			paths(k, i) = normals();
+		}
+	}
+	pathsFromNormals_(paths);
+}
+
+void EquityPriceGenerator::operator()(const CounterBasedNormals& rng, int firstScenario, ScenarioMatrix& paths) const
+{
+	if (paths.numPrices() != numTimeSteps_ + 1)
+	{
+		throw std::invalid_argument("EquityPriceGenerator: ScenarioMatrix must hold numTimeSteps + 1 prices per path");
+	}
+
+	for (int k = 0; k < paths.numScenarios(); ++k)
+	{
+		for (int i = 1; i <= numTimeSteps_; ++i)
+		{
+			paths(k, i) = rng(firstScenario + k, i - 1);
+		}
+	}
+	pathsFromNormals_(paths);
+}
+
+void EquityPriceGenerator::terminalPrices(const CounterBasedNormals& rng, int firstScenario,
+	std::span<double> prices, bool oneStep, std::pmr::memory_resource* workspace) const
+{
+	terminalPrices_(rng, firstScenario, prices, oneStep, workspace);
+}
+
+void EquityPriceGenerator::terminalPrices(const CounterBasedNormals& rng, int firstScenario,
+	std::span<float> prices, bool oneStep, std::pmr::memory_resource* workspace) const
+{
+	terminalPrices_(rng, firstScenario, prices, oneStep, workspace);
+}
+
+void EquityPriceGenerator::terminalPrices(const CounterBasedNormals& rng, int firstScenario,
+	std::span<double> prices, const PathObserver& observer, std::pmr::memory_resource* workspace) const
+{
+	advancePaths_(rng, firstScenario, prices, &observer, workspace);
+}
 
-	mt19937_64 mtEngine(seed);
-	normal_distribution<> nd;
+template<typename Real>
+void EquityPriceGenerator::terminalPrices_(const CounterBasedNormals& rng, int firstScenario,
+	std::span<Real> prices, bool oneStep, std::pmr::memory_resource* workspace) const
+{
+	const std::size_t numScens = prices.size();
 
-	auto newPrice = [this](double previousEquityPrice, double norm)
+	if (oneStep)
 	{
-		double price = 0.0;
+		for (std::size_t k = 0; k < numScens; ++k)
+		{
+			Real pair[2];
+			rng.normalPair(firstScenario + k, 0, pair);
+			prices[k] = pair[0];
+		}
+		gbmGrowthFactors(prices.data(), prices.data(), numScens, static_cast<Real>(termDrift_),
+			static_cast<Real>(termDiffusion_));
+		for (auto& price : prices)
+		{
+			price *= static_cast<Real>(initEquityPrice_);
+		}
+		return;
+	}
 
-		double expArg1 = (drift_ - ((volatility_ * volatility_) / 2.0)) * dt_;
-		double expArg2 = volatility_ * norm * sqrt(dt_);
-		price = previousEquityPrice * exp(expArg1 + expArg2);
+	advancePaths_(rng, firstScenario, prices, nullptr, workspace);
+}
 
-		return price;
+template<typename Real>
+void EquityPriceGenerator::advancePaths_(const CounterBasedNormals& rng, int firstScenario,
+	std::span<Real> prices, const PathObserver* observer, std::pmr::memory_resource* workspace) const
+{
+	const std::size_t numScens = prices.size();
+
+	// Each call to the generator yields the variates for two consecutive time steps,
+	// so the scenarios are advanced two steps at a time:
+	std::pmr::vector<Real> norms(2 * numScens, workspace);
+	std::pmr::vector<Real> prev(observer ? numScens : 0, workspace);		// Prices before the step, for the observer
+
+	auto step = [&](int i, const Real* stepNorms)		// From t_i to t_(i+1)
+	{
+		if (observer)
+		{
+			std::copy(prices.begin(), prices.end(), prev.begin());
+		}
+		gbmStep(prices.data(), stepNorms, prices.data(), numScens, static_cast<Real>(stepDrifts_[i]),
+			static_cast<Real>(stepDiffusions_[i]));
+		if constexpr (std::is_same_v<Real, double>)
+		{
+			if (observer)
+			{
+				double dt = times_[i + 1] - times_[i];
+				(*observer)(PathStep{ i + 1, times_[i + 1], dt, stepDiffusions_[i] / sqrt(dt) }, prev.data(),
+					prices.data(), numScens);
+			}
+		}
 	};
 
-	v.push_back(initEquityPrice_);				// put initial equity price into the 1st position in the vector
-	double equityPrice = initEquityPrice_;
+	std::fill(prices.begin(), prices.end(), static_cast<Real>(initEquityPrice_));
+	for (int i = 0; i < numTimeSteps_; i += 2)
+	{
+		for (std::size_t k = 0; k < numScens; ++k)
+		{
+			Real pair[2];
+			rng.normalPair(firstScenario + k, i / 2, pair);
+			norms[k] = pair[0];
+			norms[numScens + k] = pair[1];
+		}
+		step(i, norms.data());
+		if (i + 1 < numTimeSteps_)
+		{
+			step(i + 1, norms.data() + numScens);
+		}
+	}
+}
+
+void EquityPriceGenerator::writeScenarioStore(const std::string& fileName, std::int64_t seed, int numScenarios,
+	PathPrecision precision) const
+{
+	if (numScenarios <= 0)
+	{
+		throw std::invalid_argument("EquityPriceGenerator: a scenario store needs at least one scenario");
+	}
+
+	ScenarioStoreHeader header{};
+	std::memcpy(header.magic, ScenarioStore::magic, sizeof(header.magic));
+	header.version = ScenarioStore::version;
+	header.scalarSize = (precision == PathPrecision::SINGLE) ? sizeof(float) : sizeof(double);
+	header.numScenarios = numScenarios;
+	header.numTimeSteps = numTimeSteps_;
+	header.initPrice = initEquityPrice_;
+	header.seed = seed;
+	std::strncpy(header.generator, "Philox4x32-10 Box-Muller", sizeof(header.generator) - 1);
+	header.dataOffset = ScenarioStore::dataOffset(numTimeSteps_);
+
+	std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		throw std::runtime_error("EquityPriceGenerator: cannot create " + fileName);
+	}
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	for (const std::pmr::vector<double>* table : { &times_, &stepDrifts_, &stepDiffusions_ })
+	{
+		out.write(reinterpret_cast<const char*>(table->data()), table->size() * sizeof(double));
+	}
+
+	// The paths are simulated a block of scenarios at a time, step-major, and each row of
+	// the block written to its place in the corresponding row of the store:
+	CounterBasedNormals rng(seed);
+	const int blockSize = 4096;
+	const int numPrices = numTimeSteps_ + 1;
+	vector<float> row(precision == PathPrecision::SINGLE ? blockSize : 0);
+	for (int first = 0; first < numScenarios; first += blockSize)
+	{
+		int n = std::min(blockSize, numScenarios - first);
+		ScenarioMatrix paths(n, numPrices, PathLayout::STEP_MAJOR);
+		(*this)(rng, first, paths);
+		for (int i = 0; i < numPrices; ++i)
+		{
+			const double* prices = paths.data().data() + static_cast<std::size_t>(i) * n;
+			out.seekp(static_cast<std::streamoff>(header.dataOffset +
+				(static_cast<std::uint64_t>(i) * numScenarios + first) * header.scalarSize));
+			if (precision == PathPrecision::SINGLE)
+			{
+				std::copy(prices, prices + n, row.begin());
+				out.write(reinterpret_cast<const char*>(row.data()), n * sizeof(float));
+			}
+			else
+			{
+				out.write(reinterpret_cast<const char*>(prices), n * sizeof(double));
+			}
+		}
+	}
+	out.close();
+	if (!out)
+	{
+		throw std::runtime_error("EquityPriceGenerator: error writing " + fileName);
+	}
+}
+
+void EquityPriceGenerator::pathsFromNormals_(ScenarioMatrix& paths) const
+{
+	const std::size_t numScens = static_cast<std::size_t>(paths.numScenarios());
+	double* data = paths.data().data();
+
+	if (paths.layout() == PathLayout::SCENARIO_MAJOR)	// Each path is contiguous
+	{
+		for (std::size_t k = 0; k < numScens; ++k)
+		{
+			pathFromNormals_(data + k * paths.numPrices());
+		}
+		return;
+	}
+
+	// Step-major:  all scenarios at a given step are contiguous, so every path is
+	// advanced one step at a time, overwriting row i of variates with the prices at step i.
+	std::fill_n(data, numScens, initEquityPrice_);
+	for (int i = 1; i <= numTimeSteps_; ++i)
+	{
+		double* row = data + i * numScens;
+		gbmStep(row - numScens, row, row, numScens, stepDrifts_[i - 1], stepDiffusions_[i - 1]);
+	}
+}
+
+void EquityPriceGenerator::fillPath_(int seed, double* path) const
+{
+	// Draw all of the normal variates first, as one block:
+	NormalGenerator normals(seed, normalMethod_);
+	normals(path + 1, numTimeSteps_);
+	pathFromNormals_(path);
+}
+
+void EquityPriceGenerator::pathFromNormals_(double* path) const
+{
+	path[0] = initEquityPrice_;					// put initial equity price into the 1st position in the path
+
+	// Turn the variates into growth factors exp(stepDrifts_[i] + stepDiffusions_[i] * norm)
+	// with one call to the vectorized kernel; for steps that differ, the exponents are
+	// formed first, and the kernel only exponentiates them:
+	if (uniformSteps_)
+	{
+		gbmGrowthFactors(path + 1, path + 1, numTimeSteps_, stepDrifts_[0], stepDiffusions_[0]);
+	}
+	else
+	{
+		for (int i = 0; i < numTimeSteps_; ++i)
+		{
+			path[i + 1] = stepDrifts_[i] + stepDiffusions_[i] * path[i + 1];
+		}
+		gbmGrowthFactors(path + 1, path + 1, numTimeSteps_, 0.0, 1.0);
+	}
 
 	for (int i = 1; i <= numTimeSteps_; ++i)	// i <= numTimeSteps_ since we need a price at the end of the
 	{											// final time step.
-		equityPrice = newPrice(equityPrice, nd(mtEngine));	// norm = nd(mtEngine)
-		v.push_back(equityPrice);
+		path[i] *= path[i - 1];
 	}
-	
-	return v;
+}
+
+double EquityPriceGenerator::terminalPrice(int seed) const
+{
+	NormalGenerator normals(seed, normalMethod_);
+	return terminalPriceFromNormal(normals());
+}
 
+void EquityPriceGenerator::operator()(std::span<const double> normals, std::span<double> path) const
+{
+	if (normals.size() != static_cast<std::size_t>(numTimeSteps_) ||
+		path.size() != static_cast<std::size_t>(numTimeSteps_) + 1)
+	{
+		throw std::invalid_argument("EquityPriceGenerator: need numTimeSteps variates for a path of numTimeSteps + 1 prices");
+	}
+	std::copy(normals.begin(), normals.end(), path.begin() + 1);
+	pathFromNormals_(path.data());
+}
+
+double EquityPriceGenerator::terminalPriceFromNormal(double norm) const
+{
+	return initEquityPrice_ * exp(termDrift_ + termDiffusion_ * norm);
 }
 
 /*
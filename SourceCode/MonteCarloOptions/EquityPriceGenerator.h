@@ -1,26 +1,140 @@
 #ifndef EQUITY_PRICE_GENERATOR_H
 #define EQUITY_PRICE_GENERATOR_H
 
+#include "ScenarioMatrix.h"
+#include "Philox.h"
+#include "TermStructure.h"
+#include "NormalGenerator.h"
 #include <vector>
+#include <memory_resource>
+#include <span>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <cstdint>
+
+// Scalar type of simulated paths (see MCSettings::pathPrecision and writeScenarioStore(.)):
+enum class PathPrecision
+{
+	DOUBLE,
+	SINGLE		// float variates and paths; payoffs and statistics stay in double
+};
+
+// Time step i of a path, from t_(i-1) to t_i, as seen by a path observer:
+struct PathStep
+{
+	int index;			// i = 1, ..., numTimeSteps
+	double time;		// t_i
+	double dt;			// t_i - t_(i-1)
+	double volatility;	// Over the step
+};
+
+// Called after each time step with the prices of n scenarios before (prev) and after (next) it:
+using PathObserver = std::function<void(const PathStep& step, const double* prev, const double* next, std::size_t n)>;
 
 class EquityPriceGenerator
 {
 public:
-	// A more robust approach would be to add in a stub period at beginning
-	EquityPriceGenerator(double initEquityPrice, unsigned numTimeSteps, double timeToExpiry, double drift, double volatility);
+	// A more robust approach would be to add in a stub period at beginning.  The step tables
+	// are allocated from resource.
+	EquityPriceGenerator(double initEquityPrice, unsigned numTimeSteps, double timeToExpiry, double drift, double volatility,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+	// Piecewise-constant short rate and volatility on the time grid 0 < t_1 < ... < t_n (year
+	// fractions, e.g. from a date schedule and a daycount rule), so numTimeSteps = times.size().
+	// Each step is sampled exactly, from the integrals of r and sigma^2 over it; these are
+	// tabulated once here, and the generator is read-only afterwards.
+	EquityPriceGenerator(double initEquityPrice, const std::vector<double>& times, const TermStructure& rates,
+		const TermStructure& volatilities, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
-	// We could also have another ctor that takes in a TermStructure object in place of a constant drift or risk free rate,
-	// as well as a time path determined by a schedule based on dates and a daycount rule; viz,
-	// EquityPriceGenerator(double initEquityPrice, const RealSchedule& realSchedule, const TermStructure& ts, double volatility);
+	// Generator of the variates of the seeded versions below (operator()(seed, ...) and
+	// terminalPrice(seed)), from a mt19937_64 stream with the given seed.  The default, POLAR,
+	// keeps the std::normal_distribution<> variates of earlier versions; ZIGGURAT and
+	// INVERSE_CDF are faster, but give other paths for the same seed.  The counter-based
+	// versions always use their own stream.
+	void setNormalMethod(NormalMethod method);
 
 	std::vector<double> operator()(int seed) const;
 
+	// Allocation-free versions:  write the numTimeSteps + 1 prices of one path into
+	// caller-owned memory (path.size() must equal numTimeSteps + 1), or fill every
+	// path of a ScenarioMatrix in its own layout, using seed firstSeed + k for scenario k.
+	void operator()(int seed, std::span<double> path) const;
+	void operator()(int firstSeed, ScenarioMatrix& paths) const;
+
+	// Exact one-step sample of the price at timeToExpiry = t_n.  This has the same distribution as operator()(seed).back(), but it
+	// draws one normal variate and builds no path, so its cost does not depend on
+	// numTimeSteps.  Suitable for payoffs that depend on the terminal price only.
+	double terminalPrice(int seed) const;
+
+	// Versions taking the standard normal variates from the caller (for example, from a
+	// low-discrepancy sequence):  normals.size() must equal numTimeSteps for a path,
+	// while the terminal price needs the single variate of the exact one-step sample.
+	void operator()(std::span<const double> normals, std::span<double> path) const;
+	double terminalPriceFromNormal(double norm) const;
+
+	// Counter-based versions:  scenario k uses the variates rng(k, 0), rng(k, 1), ..., so
+	// any range of scenarios can be generated on any thread with the same result, and
+	// no random engine is constructed per scenario.
+	void operator()(const CounterBasedNormals& rng, int firstScenario, ScenarioMatrix& paths) const;
+
+	// Prices at timeToExpiry of scenarios firstScenario, ..., firstScenario + prices.size() - 1.
+	// Paths are advanced together one time step at a time and are not stored; with
+	// oneStep = true, S(T) is sampled exactly in a single step instead (see terminalPrice).
+	// The buffers of variates are allocated from workspace, for instance a per-thread Arena.
+	void terminalPrices(const CounterBasedNormals& rng, int firstScenario, std::span<double> prices,
+		bool oneStep, std::pmr::memory_resource* workspace = std::pmr::get_default_resource()) const;
+
+	// Single-precision paths, from the float variates of rng (see CounterBasedNormals), with
+	// the float GBM kernels:  each S(T) is within a relative 1e-5 of its double-precision
+	// counterpart, far below the Monte Carlo error.  Generating the variates still costs
+	// about as much as in double, so the gain is largest in the GBM steps.
+	void terminalPrices(const CounterBasedNormals& rng, int firstScenario, std::span<float> prices,
+		bool oneStep, std::pmr::memory_resource* workspace = std::pmr::get_default_resource()) const;
+
+	// As terminalPrices(rng, firstScenario, prices, false), calling observer after every time
+	// step.  Path-dependent payoffs can keep running statistics (an average, a maximum, a
+	// barrier indicator) this way, so the paths are never stored.
+	void terminalPrices(const CounterBasedNormals& rng, int firstScenario, std::span<double> prices,
+		const PathObserver& observer, std::pmr::memory_resource* workspace = std::pmr::get_default_resource()) const;
+
+	// Writes the paths of scenarios 0, ..., numScenarios - 1, from CounterBasedNormals(seed), to a
+	// scenario store (see ScenarioStore.h), which later jobs can map and price from without
+	// simulating.  The paths are those of operator()(rng, 0, paths), rounded to float for
+	// SINGLE.  Throws std::runtime_error if the file cannot be written.
+	void writeScenarioStore(const std::string& fileName, std::int64_t seed, int numScenarios,
+		PathPrecision precision = PathPrecision::DOUBLE) const;
+
 private:
-	double dt_;
+	// Real is the path scalar type, double or float; observers need double.
+	template<typename Real>
+	void terminalPrices_(const CounterBasedNormals& rng, int firstScenario, std::span<Real> prices,
+		bool oneStep, std::pmr::memory_resource* workspace) const;
+	template<typename Real>
+	void advancePaths_(const CounterBasedNormals& rng, int firstScenario, std::span<Real> prices,
+		const PathObserver* observer, std::pmr::memory_resource* workspace) const;
+	void fillPath_(int seed, double* path) const;
+	void pathFromNormals_(double* path) const;				// path[1], ..., path[numTimeSteps] hold the variates on entry
+	void pathsFromNormals_(ScenarioMatrix& paths) const;	// Rows 1, ..., numTimeSteps hold the variates on entry
+
+	void initialize_(const TermStructure& rates, const TermStructure& volatilities);
+
 	const double initEquityPrice_;
 	const int numTimeSteps_;
-	const double drift_;
-	const double volatility_;
+	std::pmr::vector<double> times_;		// t_0 = 0, t_1, ..., t_n
+
+	// Exact GBM step i, from t_i to t_(i+1):  S -> S * exp(stepDrifts_[i] + stepDiffusions_[i] * norm).
+	// A step costs the same as with constant coefficients:  the kernels take the two numbers
+	// of the step as scalars.
+	std::pmr::vector<double> stepDrifts_;		// Integral of r - sigma^2/2 over the step
+	std::pmr::vector<double> stepDiffusions_;	// Square root of the integral of sigma^2 over the step
+	bool uniformSteps_;		// All steps alike, so a whole path can be passed to one kernel call
+
+	// Exact one-step sample of S(T), likewise:
+	double termDrift_;
+	double termDiffusion_;
+
+	NormalMethod normalMethod_ = NormalMethod::POLAR;
 };
 
 #endif
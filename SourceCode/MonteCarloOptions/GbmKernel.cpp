@@ -0,0 +1,348 @@
+#include "GbmKernel.h"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define GBM_KERNEL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define GBM_KERNEL_X86 0
+#endif
+
+// GCC and Clang only emit AVX instructions in functions marked for them;
+// MSVC accepts the intrinsics anywhere.
+#if defined(__GNUC__)
+#define GBM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define GBM_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define GBM_TARGET_AVX2
+#define GBM_TARGET_AVX512
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC's own AVX-512 headers trip this warning via _mm512_undefined_pd():
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace
+{
+	// exp(x) = 2^k * exp(r), with k = round(x / ln 2) and |r| <= ln(2)/2.  exp(r) is
+	// approximated by its Taylor polynomial of degree 13 (truncation error < 1e-17),
+	// and ln 2 is split in two (Cephes) so that x - k*ln 2 is computed without loss.
+	constexpr double log2e = 1.4426950408889634074;
+	constexpr double ln2Hi = 6.93145751953125E-1;
+	constexpr double ln2Lo = 1.42860682030941723212E-6;
+	constexpr double expMax = 709.0;
+	constexpr double expMin = -708.0;
+	constexpr int expDegree = 13;
+	constexpr double expCoeffs[expDegree + 1] =		// 1/j!
+	{
+		1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0, 1.0 / 120.0, 1.0 / 720.0, 1.0 / 5040.0,
+		1.0 / 40320.0, 1.0 / 362880.0, 1.0 / 3628800.0, 1.0 / 39916800.0,
+		1.0 / 479001600.0, 1.0 / 6227020800.0
+	};
+
+	// Single precision, likewise:  |r| <= ln(2)/2 needs degree 7 (truncation error < 1e-8),
+	// and ln 2 = ln2HiF - ln2LoF with ln2HiF exact in float (Cephes expf).
+	constexpr float log2eF = 1.44269504f;
+	constexpr float ln2HiF = 0.693359375f;
+	constexpr float ln2LoF = -2.12194440e-4f;
+	constexpr float expMaxF = 88.0f;
+	constexpr float expMinF = -87.0f;
+	constexpr int expDegreeF = 7;
+
+	// prev == nullptr computes the growth factors alone (as if prev[i] = 1).
+	template<typename Real>
+	void gbmScalar_(const Real* prev, const Real* normals, Real* next, std::size_t n,
+		Real drift, Real diffusion)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			Real factor = std::exp(drift + diffusion * normals[i]);
+			next[i] = prev ? prev[i] * factor : factor;
+		}
+	}
+
+#if GBM_KERNEL_X86
+	GBM_TARGET_AVX2 inline __m256d exp256_(__m256d x)
+	{
+		x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(expMin)), _mm256_set1_pd(expMax));
+		__m256d k = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(log2e)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(ln2Hi), x);
+		r = _mm256_fnmadd_pd(k, _mm256_set1_pd(ln2Lo), r);
+
+		__m256d p = _mm256_set1_pd(expCoeffs[expDegree]);
+		for (int j = expDegree - 1; j >= 0; --j)
+		{
+			p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(expCoeffs[j]));
+		}
+
+		// AVX2 has no double -> int64 conversion; adding 1.5 * 2^52 puts the integer k
+		// in the low mantissa bits instead.  Then 2^k is built in the exponent field.
+		const __m256d magic = _mm256_set1_pd(0x1.8p52);
+		__m256i ki = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(k, magic)),
+			_mm256_castpd_si256(magic));
+		__m256i twoToK = _mm256_slli_epi64(_mm256_add_epi64(ki, _mm256_set1_epi64x(1023)), 52);
+		return _mm256_mul_pd(p, _mm256_castsi256_pd(twoToK));
+	}
+
+	GBM_TARGET_AVX2 void gbmAvx2_(const double* prev, const double* normals, double* next, std::size_t n,
+		double drift, double diffusion)
+	{
+		const __m256d a = _mm256_set1_pd(drift);
+		const __m256d b = _mm256_set1_pd(diffusion);
+
+		std::size_t i = 0;
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256d factor = exp256_(_mm256_fmadd_pd(b, _mm256_loadu_pd(normals + i), a));
+			if (prev)
+			{
+				factor = _mm256_mul_pd(_mm256_loadu_pd(prev + i), factor);
+			}
+			_mm256_storeu_pd(next + i, factor);
+		}
+		gbmScalar_<double>(prev ? prev + i : nullptr, normals + i, next + i, n - i, drift, diffusion);
+	}
+
+	GBM_TARGET_AVX512 inline __m512d exp512_(__m512d x)
+	{
+		x = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(expMin)), _mm512_set1_pd(expMax));
+		__m512d k = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(log2e)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m512d r = _mm512_fnmadd_pd(k, _mm512_set1_pd(ln2Hi), x);
+		r = _mm512_fnmadd_pd(k, _mm512_set1_pd(ln2Lo), r);
+
+		__m512d p = _mm512_set1_pd(expCoeffs[expDegree]);
+		for (int j = expDegree - 1; j >= 0; --j)
+		{
+			p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(expCoeffs[j]));
+		}
+		return _mm512_scalef_pd(p, k);		// p * 2^k
+	}
+
+	GBM_TARGET_AVX512 void gbmAvx512_(const double* prev, const double* normals, double* next, std::size_t n,
+		double drift, double diffusion)
+	{
+		const __m512d a = _mm512_set1_pd(drift);
+		const __m512d b = _mm512_set1_pd(diffusion);
+
+		for (std::size_t i = 0; i < n; i += 8)
+		{
+			// Masked loads and stores handle the last n % 8 elements:
+			__mmask8 m = (n - i >= 8) ? static_cast<__mmask8>(0xFF) :
+				static_cast<__mmask8>((1u << (n - i)) - 1);
+			__m512d factor = exp512_(_mm512_fmadd_pd(b, _mm512_maskz_loadu_pd(m, normals + i), a));
+			if (prev)
+			{
+				factor = _mm512_mul_pd(_mm512_maskz_loadu_pd(m, prev + i), factor);
+			}
+			_mm512_mask_storeu_pd(next + i, m, factor);
+		}
+	}
+
+	GBM_TARGET_AVX2 inline __m256 exp256f_(__m256 x)
+	{
+		x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(expMinF)), _mm256_set1_ps(expMaxF));
+		__m256 k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(log2eF)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256 r = _mm256_fnmadd_ps(k, _mm256_set1_ps(ln2HiF), x);
+		r = _mm256_fnmadd_ps(k, _mm256_set1_ps(ln2LoF), r);
+
+		__m256 p = _mm256_set1_ps(static_cast<float>(expCoeffs[expDegreeF]));
+		for (int j = expDegreeF - 1; j >= 0; --j)
+		{
+			p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(static_cast<float>(expCoeffs[j])));
+		}
+
+		// k is in [-126, 127] after the clamp, so 2^k is a normal float:
+		__m256i twoToK = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(k), _mm256_set1_epi32(127)), 23);
+		return _mm256_mul_ps(p, _mm256_castsi256_ps(twoToK));
+	}
+
+	GBM_TARGET_AVX2 void gbmAvx2F_(const float* prev, const float* normals, float* next, std::size_t n,
+		float drift, float diffusion)
+	{
+		const __m256 a = _mm256_set1_ps(drift);
+		const __m256 b = _mm256_set1_ps(diffusion);
+
+		std::size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 factor = exp256f_(_mm256_fmadd_ps(b, _mm256_loadu_ps(normals + i), a));
+			if (prev)
+			{
+				factor = _mm256_mul_ps(_mm256_loadu_ps(prev + i), factor);
+			}
+			_mm256_storeu_ps(next + i, factor);
+		}
+		gbmScalar_<float>(prev ? prev + i : nullptr, normals + i, next + i, n - i, drift, diffusion);
+	}
+
+	GBM_TARGET_AVX512 inline __m512 exp512f_(__m512 x)
+	{
+		x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(expMinF)), _mm512_set1_ps(expMaxF));
+		__m512 k = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(log2eF)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m512 r = _mm512_fnmadd_ps(k, _mm512_set1_ps(ln2HiF), x);
+		r = _mm512_fnmadd_ps(k, _mm512_set1_ps(ln2LoF), r);
+
+		__m512 p = _mm512_set1_ps(static_cast<float>(expCoeffs[expDegreeF]));
+		for (int j = expDegreeF - 1; j >= 0; --j)
+		{
+			p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(static_cast<float>(expCoeffs[j])));
+		}
+		return _mm512_scalef_ps(p, k);		// p * 2^k
+	}
+
+	GBM_TARGET_AVX512 void gbmAvx512F_(const float* prev, const float* normals, float* next, std::size_t n,
+		float drift, float diffusion)
+	{
+		const __m512 a = _mm512_set1_ps(drift);
+		const __m512 b = _mm512_set1_ps(diffusion);
+
+		for (std::size_t i = 0; i < n; i += 16)
+		{
+			__mmask16 m = (n - i >= 16) ? static_cast<__mmask16>(0xFFFF) :
+				static_cast<__mmask16>((1u << (n - i)) - 1);
+			__m512 factor = exp512f_(_mm512_fmadd_ps(b, _mm512_maskz_loadu_ps(m, normals + i), a));
+			if (prev)
+			{
+				factor = _mm512_mul_ps(_mm512_maskz_loadu_ps(m, prev + i), factor);
+			}
+			_mm512_mask_storeu_ps(next + i, m, factor);
+		}
+	}
+#endif
+
+	SimdLevel detectSimdLevel_()
+	{
+#if GBM_KERNEL_X86
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+		{
+			return SimdLevel::SCALAR;
+		}
+		__cpuid(info, 1);
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool fma = (info[2] & (1 << 12)) != 0;
+		if (!osxsave)
+		{
+			return SimdLevel::SCALAR;
+		}
+		// The OS must also save the wider registers on a context switch:
+		unsigned long long xcr0 = _xgetbv(0);
+		__cpuidex(info, 7, 0);
+		bool avx2 = (info[1] & (1 << 5)) != 0;
+		bool avx512f = (info[1] & (1 << 16)) != 0;
+		if (avx512f && (xcr0 & 0xE6) == 0xE6)
+		{
+			return SimdLevel::AVX512;
+		}
+		if (avx2 && fma && (xcr0 & 0x6) == 0x6)
+		{
+			return SimdLevel::AVX2;
+		}
+#else
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f"))
+		{
+			return SimdLevel::AVX512;
+		}
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		{
+			return SimdLevel::AVX2;
+		}
+#endif
+#endif
+		return SimdLevel::SCALAR;
+	}
+
+	template<typename Real>
+	using GbmImpl = void (*)(const Real*, const Real*, Real*, std::size_t, Real, Real);
+
+	GbmImpl<double> selectImpl_()
+	{
+		switch (gbmKernelLevel())
+		{
+#if GBM_KERNEL_X86
+		case SimdLevel::AVX512:
+			return gbmAvx512_;
+		case SimdLevel::AVX2:
+			return gbmAvx2_;
+#endif
+		default:
+			return gbmScalar_<double>;
+		}
+	}
+
+	GbmImpl<float> selectImplF_()
+	{
+		switch (gbmKernelLevel())
+		{
+#if GBM_KERNEL_X86
+		case SimdLevel::AVX512:
+			return gbmAvx512F_;
+		case SimdLevel::AVX2:
+			return gbmAvx2F_;
+#endif
+		default:
+			return gbmScalar_<float>;
+		}
+	}
+}
+
+SimdLevel gbmKernelLevel()
+{
+	static const SimdLevel level = detectSimdLevel_();
+	return level;
+}
+
+void gbmStep(const double* prev, const double* normals, double* next, std::size_t n,
+	double drift, double diffusion)
+{
+	static const GbmImpl<double> impl = selectImpl_();
+	impl(prev, normals, next, n, drift, diffusion);
+}
+
+void gbmGrowthFactors(const double* normals, double* factors, std::size_t n,
+	double drift, double diffusion)
+{
+	static const GbmImpl<double> impl = selectImpl_();
+	impl(nullptr, normals, factors, n, drift, diffusion);
+}
+
+void gbmStep(const float* prev, const float* normals, float* next, std::size_t n,
+	float drift, float diffusion)
+{
+	static const GbmImpl<float> impl = selectImplF_();
+	impl(prev, normals, next, n, drift, diffusion);
+}
+
+void gbmGrowthFactors(const float* normals, float* factors, std::size_t n,
+	float drift, float diffusion)
+{
+	static const GbmImpl<float> impl = selectImplF_();
+	impl(nullptr, normals, factors, n, drift, diffusion);
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
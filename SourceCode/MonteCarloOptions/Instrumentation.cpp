@@ -0,0 +1,84 @@
+#include "Instrumentation.h"
+#include <sstream>
+
+CountingResource::CountingResource(std::pmr::memory_resource* upstream) :upstream_(upstream)
+{
+}
+
+std::uint64_t CountingResource::allocations() const
+{
+	return allocations_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t CountingResource::bytesAllocated() const
+{
+	return bytesAllocated_.load(std::memory_order_relaxed);
+}
+
+void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	allocations_.fetch_add(1, std::memory_order_relaxed);
+	bytesAllocated_.fetch_add(bytes, std::memory_order_relaxed);
+	return upstream_->allocate(bytes, alignment);
+}
+
+void CountingResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+{
+	upstream_->deallocate(p, bytes, alignment);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+void PhaseTimes::merge(const PhaseTimes& other)
+{
+	setup += other.setup;
+	pathGeneration += other.pathGeneration;
+	payoffEvaluation += other.payoffEvaluation;
+	reduction += other.reduction;
+}
+
+std::string PricerStats::toJson() const
+{
+	std::ostringstream json;
+	json.precision(9);
+	json << "{\"wallTime\": " << wallTime << ", \"cpuTime\": " << cpuTime
+		<< ", \"phases\": {\"setup\": " << phases.setup << ", \"pathGeneration\": " << phases.pathGeneration
+		<< ", \"payoffEvaluation\": " << phases.payoffEvaluation << ", \"reduction\": " << phases.reduction
+		<< "}, \"numPaths\": " << numPaths << ", \"pathsPerSecond\": " << pathsPerSecond
+		<< ", \"allocations\": " << allocations << ", \"peakBytes\": " << peakBytes << "}";
+	return json.str();
+}
+
+RunTimer::RunTimer(const CountingResource* allocationCounter) :wallBegin_(std::chrono::steady_clock::now()),
+	cpuBegin_(std::clock()), allocationCounter_(allocationCounter),
+	allocationsBegin_(allocationCounter ? allocationCounter->allocations() : 0)
+{
+}
+
+void RunTimer::stop(PricerStats& stats) const
+{
+	stats.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallBegin_).count();
+	stats.cpuTime = double(std::clock() - cpuBegin_) / CLOCKS_PER_SEC;
+	stats.allocations = allocationCounter_ ?
+		static_cast<long long>(allocationCounter_->allocations() - allocationsBegin_) : -1;
+	stats.pathsPerSecond = stats.wallTime > 0.0 ? stats.numPaths / stats.wallTime : 0.0;
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
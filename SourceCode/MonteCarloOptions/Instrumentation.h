@@ -0,0 +1,114 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <chrono>
+#include <ctime>
+#include <cstdint>
+#include <string>
+#include <atomic>
+#include <memory_resource>
+
+// Seconds spent in each phase of a simulation.  Phases that run on worker threads are
+// summed over the threads, so with several threads they can add up to more than the
+// wall-clock time.
+struct PhaseTimes
+{
+	double setup = 0.0;				// Seeds, keys, Sobol direction numbers, ...
+	double pathGeneration = 0.0;
+	double payoffEvaluation = 0.0;
+	double reduction = 0.0;			// Merging block results and computing estimates
+
+	void merge(const PhaseTimes& other);
+};
+
+// Run statistics of a pricer.  wallTime is measured with std::chrono::steady_clock;
+// cpuTime is the process CPU time from std::clock(), which is summed over all threads,
+// so cpuTime / wallTime shows how many cores were kept busy.
+struct PricerStats
+{
+	double wallTime = 0.0;
+	double cpuTime = 0.0;
+	PhaseTimes phases;
+	long long numPaths = 0;
+	double pathsPerSecond = 0.0;	// numPaths / wallTime
+	long long allocations = -1;		// Allocations from a CountingResource during the run; -1 if not counted
+	long long peakBytes = 0;		// Most scratch memory held at once in the arenas, summed over threads
+
+	std::string toJson() const;
+};
+
+// Adds the wall-clock time from construction to destruction to a counter:
+class ScopedTimer
+{
+public:
+	explicit ScopedTimer(double& seconds) :seconds_(seconds), begin_(std::chrono::steady_clock::now()) {}
+	~ScopedTimer()
+	{
+		seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin_).count();
+	}
+
+	ScopedTimer(const ScopedTimer&) = delete;
+	ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+	double& seconds_;
+	std::chrono::steady_clock::time_point begin_;
+};
+
+// Memory resource that passes allocations on to an upstream resource and counts them.  It is
+// opt-in:  given as MCSettings::memoryResource, for instance, it counts the memory that the
+// arenas of MCEuroOptPricer draw, which should be none when repricing.  Thread-safe if the
+// upstream resource is.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+	explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+	CountingResource(const CountingResource&) = delete;
+	CountingResource& operator=(const CountingResource&) = delete;
+
+	std::uint64_t allocations() const;		// Calls to allocate(.) since construction
+	std::uint64_t bytesAllocated() const;	// Bytes requested by them
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	std::pmr::memory_resource* upstream_;
+	std::atomic<std::uint64_t> allocations_{ 0 };
+	std::atomic<std::uint64_t> bytesAllocated_{ 0 };
+};
+
+// Measures a whole run:  wall time, CPU time and, if a counter is given, allocations between
+// construction and stop(.), which fills the corresponding fields of stats and pathsPerSecond.
+class RunTimer
+{
+public:
+	explicit RunTimer(const CountingResource* allocationCounter = nullptr);
+	void stop(PricerStats& stats) const;
+
+private:
+	std::chrono::steady_clock::time_point wallBegin_;
+	std::clock_t cpuBegin_;
+	const CountingResource* allocationCounter_;
+	std::uint64_t allocationsBegin_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
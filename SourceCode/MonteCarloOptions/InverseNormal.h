@@ -0,0 +1,101 @@
+#ifndef INVERSE_NORMAL_H
+#define INVERSE_NORMAL_H
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+// Coefficients of P. J. Acklam's rational approximations:  a, b for the central region
+// |p - 0.5| <= 0.5 - pLow, c, d for the tails.
+namespace acklam
+{
+	constexpr double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+		1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+	constexpr double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+		6.680131188771972e+01, -1.328068155288572e+01 };
+	constexpr double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+		-2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+	constexpr double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+		3.754408661907416e+00 };
+	constexpr double pLow = 0.02425;
+
+	inline double central(double p)
+	{
+		double q = p - 0.5;
+		double r = q * q;
+		return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+			(((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+	}
+
+	inline double lowerTail(double p)		// p < pLow
+	{
+		double q = std::sqrt(-2.0 * std::log(p));
+		return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+			((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+	}
+}
+
+// Inverse of the standard normal cumulative distribution function, by P. J. Acklam's
+// rational approximation (relative error below 1.15e-9), for p strictly inside (0, 1).
+// Used to turn low-discrepancy uniforms into normal variates, where the usual
+// rejection methods cannot be used.
+inline double inverseNormalCdf(double p)
+{
+	if (p < acklam::pLow)			// Lower tail
+	{
+		return acklam::lowerTail(p);
+	}
+	if (p > 1.0 - acklam::pLow)		// Upper tail, by symmetry
+	{
+		return -acklam::lowerTail(1.0 - p);
+	}
+	return acklam::central(p);
+}
+
+// normals[i] = inverseNormalCdf(uniforms[i]), i = 0, ..., n - 1 (normals may alias uniforms).
+// The central formula, a ratio of polynomials, is applied to every element in a loop without
+// branches, which the compiler can vectorize; the indices of the elements in the tails (about
+// 5% of uniform samples) are collected on the way, also without branching, and only those
+// are then corrected with the tail formula, which needs a log and a square root.
+inline void inverseNormalCdf(const double* uniforms, double* normals, std::size_t n)
+{
+	constexpr std::size_t chunk = 256;
+	std::size_t tails[chunk];
+	double tailUniforms[chunk];		// Kept, as normals may overwrite uniforms
+	for (std::size_t begin = 0; begin < n; begin += chunk)
+	{
+		std::size_t end = std::min(begin + chunk, n);
+		std::size_t numTails = 0;
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			double p = uniforms[i];
+			tails[numTails] = i;
+			tailUniforms[numTails] = p;
+			numTails += (std::min(p, 1.0 - p) < acklam::pLow);
+			normals[i] = acklam::central(p);
+		}
+		for (std::size_t j = 0; j < numTails; ++j)
+		{
+			double p = tailUniforms[j];
+			normals[tails[j]] = (p < 0.5) ? acklam::lowerTail(p) : -acklam::lowerTail(1.0 - p);
+		}
+	}
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,425 @@
+#include "MCAmericanOptPricer.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+
+using std::vector;
+
+namespace
+{
+	// In-the-money paths whose basis functions are laid out and multiplied together at once;
+	// numBasis rows of this many doubles stay in the L1 or L2 cache:
+	constexpr std::size_t regressionChunk = 256;
+
+	// Solves gram * x = rhs in place (x in rhs) by Cholesky factorization, gram symmetric
+	// positive semi-definite, n x n.  A ridge of 1e-12 of the largest diagonal element keeps
+	// the factorization defined when basis functions are (nearly) collinear on the sample.
+	void solveNormalEquations_(vector<double>& gram, vector<double>& rhs, int n)
+	{
+		double ridge = 0.0;
+		for (int r = 0; r < n; ++r)
+		{
+			ridge = std::max(ridge, gram[r * n + r]);
+		}
+		ridge *= 1.0e-12;
+		for (int r = 0; r < n; ++r)
+		{
+			gram[r * n + r] += ridge;
+		}
+
+		// gram = L L^T, L in the lower triangle:
+		for (int c = 0; c < n; ++c)
+		{
+			double diagonal = gram[c * n + c];
+			for (int k = 0; k < c; ++k)
+			{
+				diagonal -= gram[c * n + k] * gram[c * n + k];
+			}
+			diagonal = std::sqrt(std::max(diagonal, ridge));
+			gram[c * n + c] = diagonal;
+			for (int r = c + 1; r < n; ++r)
+			{
+				double sum = gram[r * n + c];
+				for (int k = 0; k < c; ++k)
+				{
+					sum -= gram[r * n + k] * gram[c * n + k];
+				}
+				gram[r * n + c] = sum / diagonal;
+			}
+		}
+
+		// L y = rhs, then L^T x = y:
+		for (int r = 0; r < n; ++r)
+		{
+			for (int k = 0; k < r; ++k)
+			{
+				rhs[r] -= gram[r * n + k] * rhs[k];
+			}
+			rhs[r] /= gram[r * n + r];
+		}
+		for (int r = n - 1; r >= 0; --r)
+		{
+			for (int k = r + 1; k < n; ++k)
+			{
+				rhs[r] -= gram[k * n + r] * rhs[k];
+			}
+			rhs[r] /= gram[r * n + r];
+		}
+	}
+}
+
+double MCAmericanOptPricer::operator()() const
+{
+	return price_;
+}
+
+double MCAmericanOptPricer::stdError() const
+{
+	return stdError_;
+}
+
+double MCAmericanOptPricer::time() const
+{
+	return stats_.wallTime;
+}
+
+const PricerStats& MCAmericanOptPricer::stats() const
+{
+	return stats_;
+}
+
+double MCAmericanOptPricer::earlyExerciseFraction() const
+{
+	return earlyExerciseFraction_;
+}
+
+void MCAmericanOptPricer::calculate_()
+{
+	if (settings_.sampling != SamplingScheme::PSEUDO_RANDOM || settings_.terminalSampling)
+	{
+		throw std::invalid_argument("MCAmericanOptPricer: only PSEUDO_RANDOM sampling of whole paths is supported");
+	}
+	if (settings_.antithetic || settings_.controlVariate || settings_.computeGreeks ||
+		settings_.targetStdError > 0.0 || settings_.numProcesses > 1)
+	{
+		throw std::invalid_argument("MCAmericanOptPricer: antithetic, control variate, Greeks, target error and "
+			"worker processes are not supported");
+	}
+	if (regression_.degree < 1 || numTimeSteps_ < 1)
+	{
+		throw std::invalid_argument("MCAmericanOptPricer: needs at least one basis function per asset and one time step");
+	}
+
+	stats_ = PricerStats();
+	RunTimer runTimer;
+
+	std::optional<ScopedTimer> setupTimer(std::in_place, stats_.phases.setup);
+	CounterBasedNormals rng(initSeed_);
+	int numBlocks = (numScenarios_ + settings_.blockSize - 1) / settings_.blockSize;
+	vector<Block_> blocks(numBlocks);
+	vector<PhaseTimes> blockTimes(numBlocks);
+	ThreadPool* pool = settings_.runParallel ? &ThreadPool::shared(settings_.numThreads) : nullptr;
+	setupTimer.reset();
+
+	// Forward:  the cash flows at expiry, and the in-the-money states of every exercise date.
+	forEachTask(pool, numBlocks, [this, &rng, &blocks, &blockTimes](int block)
+	{
+		simulateBlock_(rng, block, blocks[block], blockTimes[block]);
+	});
+
+	// Backward induction.  Each block adds its normal equations to its own slot, and the
+	// slots are summed in block order:
+	std::optional<ScopedTimer> regressionTimer(std::in_place, stats_.phases.payoffEvaluation);
+	const int numBasis = numBasis_();
+	const std::size_t slotSize = static_cast<std::size_t>(numBasis) * (numBasis + 1);
+	vector<double> slots(numBlocks * slotSize);
+	vector<double> gram(numBasis * numBasis), coefficients(numBasis);
+	for (int i = numTimeSteps_ - 1; i >= 1; --i)
+	{
+		std::fill(slots.begin(), slots.end(), 0.0);
+		forEachTask(pool, numBlocks, [this, &blocks, &slots, slotSize, numBasis, i](int block)
+		{
+			double* slot = slots.data() + block * slotSize;
+			accumulateRegression_(blocks[block], i, slot, slot + numBasis * numBasis);
+		});
+
+		std::fill(gram.begin(), gram.end(), 0.0);
+		std::fill(coefficients.begin(), coefficients.end(), 0.0);
+		for (int block = 0; block < numBlocks; ++block)
+		{
+			const double* slot = slots.data() + block * slotSize;
+			for (int b = 0; b < numBasis * numBasis; ++b)
+			{
+				gram[b] += slot[b];
+			}
+			for (int b = 0; b < numBasis; ++b)
+			{
+				coefficients[b] += slot[numBasis * numBasis + b];
+			}
+		}
+
+		// gram[0] counts the in-the-money paths (the constant function squared).  With too
+		// few to regress on, the option is held at this date.
+		if (gram[0] < 2.0 * numBasis)
+		{
+			continue;
+		}
+		solveNormalEquations_(gram, coefficients, numBasis);
+		forEachTask(pool, numBlocks, [this, &blocks, &coefficients, i](int block)
+		{
+			exercise_(blocks[block], i, coefficients);
+		});
+	}
+	regressionTimer.reset();
+
+	// Merge in block order, so the results do not depend on the number of threads:
+	std::optional<ScopedTimer> reductionTimer(std::in_place, stats_.phases.reduction);
+	RunningStats stats;
+	long long numEarly = 0;
+	for (int block = 0; block < numBlocks; ++block)
+	{
+		stats.addBlock(blocks[block].values.data(), blocks[block].values.size());
+		numEarly += std::count_if(blocks[block].exerciseSteps.begin(), blocks[block].exerciseSteps.end(),
+			[this](int step) { return step < numTimeSteps_; });
+		stats_.phases.merge(blockTimes[block]);
+	}
+
+	// Exercise at t_0 if the payoff there beats the estimated value of holding:
+	double immediate;
+	payoff_(spots_, 1, &immediate);
+	if (immediate > stats.mean())
+	{
+		price_ = quantity_ * immediate;
+		stdError_ = 0.0;
+		earlyExerciseFraction_ = 1.0;
+	}
+	else
+	{
+		price_ = quantity_ * stats.mean();
+		stdError_ = std::abs(quantity_) * stats.stdError();
+		earlyExerciseFraction_ = static_cast<double>(numEarly) / numScenarios_;
+	}
+	reductionTimer.reset();
+
+	stats_.numPaths = numScenarios_;
+	runTimer.stop(stats_);
+}
+
+void MCAmericanOptPricer::simulateBlock_(const CounterBasedNormals& rng, int block, Block_& paths,
+	PhaseTimes& times) const
+{
+	int first = block * settings_.blockSize;
+	std::size_t n = std::min(first + settings_.blockSize, numScenarios_) - first;
+	std::size_t numAssets = spots_.size();
+
+	// Whole paths of the block, asset x step x scenario; dropped on return:
+	MultiAssetScenarios scenarios(static_cast<int>(numAssets), numTimeSteps_ + 1, static_cast<int>(n));
+	{
+		ScopedTimer timer(times.pathGeneration);
+		paths_(rng, first, scenarios);
+	}
+
+	ScopedTimer timer(times.payoffEvaluation);
+	vector<double> prices(numAssets * n), payoffs(n);
+	auto evaluate = [this, &scenarios, &prices, &payoffs, numAssets, n](int step)
+	{
+		for (std::size_t a = 0; a < numAssets; ++a)
+		{
+			std::span<const double> row = scenarios.prices(static_cast<int>(a), step);
+			std::copy(row.begin(), row.end(), prices.begin() + a * n);
+		}
+		payoff_(prices, n, payoffs.data());
+	};
+
+	// Until an earlier exercise is found, each scenario is held to expiry:
+	const double dt = timeToExpiry_ / numTimeSteps_;
+	evaluate(numTimeSteps_);
+	paths.values.resize(n);
+	for (std::size_t k = 0; k < n; ++k)
+	{
+		paths.values[k] = payoffs[k] * std::exp(-riskFreeRate_ * timeToExpiry_);
+	}
+	paths.exerciseSteps.assign(n, numTimeSteps_);
+
+	paths.itmBegin.assign(numTimeSteps_, 0);
+	for (int i = 1; i < numTimeSteps_; ++i)
+	{
+		evaluate(i);
+		double discount = std::exp(-riskFreeRate_ * i * dt);
+		std::size_t begin = paths.scenarios.size();
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			if (payoffs[k] > 0.0)
+			{
+				paths.scenarios.push_back(static_cast<int>(k));
+				paths.payoffs.push_back(discount * payoffs[k]);
+			}
+		}
+		for (std::size_t a = 0; a < numAssets; ++a)
+		{
+			for (std::size_t e = begin; e < paths.scenarios.size(); ++e)
+			{
+				paths.prices.push_back(prices[a * n + paths.scenarios[e]]);
+			}
+		}
+		paths.itmBegin[i] = paths.scenarios.size();
+	}
+}
+
+void MCAmericanOptPricer::accumulateRegression_(const Block_& paths, int i, double* gram, double* rhs) const
+{
+	const std::size_t begin = paths.itmBegin[i - 1];
+	const std::size_t m = paths.itmBegin[i] - begin;
+	const double* prices = paths.prices.data() + spots_.size() * begin;
+	const int numBasis = numBasis_();
+
+	vector<double> basis(numBasis * regressionChunk), values(regressionChunk);
+	for (std::size_t c = 0; c < m; c += regressionChunk)
+	{
+		std::size_t count = std::min(regressionChunk, m - c);
+		basisFunctions_(prices + c, m, paths.payoffs.data() + begin + c, count, basis.data(), regressionChunk);
+		for (std::size_t j = 0; j < count; ++j)
+		{
+			values[j] = paths.values[paths.scenarios[begin + c + j]];
+		}
+
+		// Lower triangle of B B^T, and B y, one pair of contiguous rows at a time:
+		for (int r = 0; r < numBasis; ++r)
+		{
+			const double* rowR = basis.data() + r * regressionChunk;
+			for (int s = 0; s <= r; ++s)
+			{
+				const double* rowS = basis.data() + s * regressionChunk;
+				double sum = 0.0;
+				for (std::size_t j = 0; j < count; ++j)
+				{
+					sum += rowR[j] * rowS[j];
+				}
+				gram[r * numBasis + s] += sum;
+			}
+			double sum = 0.0;
+			for (std::size_t j = 0; j < count; ++j)
+			{
+				sum += rowR[j] * values[j];
+			}
+			rhs[r] += sum;
+		}
+	}
+	for (int r = 0; r < numBasis; ++r)
+	{
+		for (int s = 0; s < r; ++s)
+		{
+			gram[s * numBasis + r] = gram[r * numBasis + s];
+		}
+	}
+}
+
+void MCAmericanOptPricer::exercise_(Block_& paths, int i, const vector<double>& coefficients) const
+{
+	const std::size_t begin = paths.itmBegin[i - 1];
+	const std::size_t m = paths.itmBegin[i] - begin;
+	const double* prices = paths.prices.data() + spots_.size() * begin;
+	const int numBasis = numBasis_();
+
+	vector<double> basis(numBasis * regressionChunk), continuation(regressionChunk);
+	for (std::size_t c = 0; c < m; c += regressionChunk)
+	{
+		std::size_t count = std::min(regressionChunk, m - c);
+		basisFunctions_(prices + c, m, paths.payoffs.data() + begin + c, count, basis.data(), regressionChunk);
+		std::fill(continuation.begin(), continuation.begin() + count, 0.0);
+		for (int b = 0; b < numBasis; ++b)
+		{
+			const double* row = basis.data() + b * regressionChunk;
+			for (std::size_t j = 0; j < count; ++j)
+			{
+				continuation[j] += coefficients[b] * row[j];
+			}
+		}
+		for (std::size_t j = 0; j < count; ++j)
+		{
+			std::size_t e = begin + c + j;
+			if (paths.payoffs[e] > continuation[j])
+			{
+				paths.values[paths.scenarios[e]] = paths.payoffs[e];
+				paths.exerciseSteps[paths.scenarios[e]] = i;
+			}
+		}
+	}
+}
+
+int MCAmericanOptPricer::numBasis_() const
+{
+	return 1 + static_cast<int>(spots_.size()) * regression_.degree + (regression_.payoffInBasis ? 1 : 0);
+}
+
+void MCAmericanOptPricer::basisFunctions_(const double* prices, std::size_t m, const double* payoffs,
+	std::size_t count, double* basis, std::size_t stride) const
+{
+	const int degree = regression_.degree;
+	std::fill(basis, basis + count, 1.0);
+	int row = 1;
+	for (std::size_t a = 0; a < spots_.size(); ++a)
+	{
+		const double* assetPrices = prices + a * m;
+		double* x = basis + row * stride;
+		for (std::size_t j = 0; j < count; ++j)
+		{
+			x[j] = assetPrices[j] / spots_[a];
+		}
+		if (regression_.basis == BasisFunctions::MONOMIAL)
+		{
+			for (int d = 1; d < degree; ++d)
+			{
+				const double* previous = x + (d - 1) * stride;
+				double* next = x + d * stride;
+				for (std::size_t j = 0; j < count; ++j)
+				{
+					next[j] = previous[j] * x[j];
+				}
+			}
+		}
+		else
+		{
+			// Weighted Laguerre, by (n + 1) L_(n+1) = (2n + 1 - x) L_n - n L_(n-1); the recurrence is
+			// linear, so it holds for e^(-x/2) L_n too.  The row of x becomes that of e^(-x/2) L_0.
+			for (std::size_t j = 0; j < count; ++j)
+			{
+				double xj = x[j];
+				double weight = std::exp(-0.5 * xj);
+				double previous = 0.0;
+				double current = weight;
+				x[j] = current;
+				for (int d = 1; d < degree; ++d)
+				{
+					double next = ((2 * d - 1 - xj) * current - (d - 1) * previous) / d;
+					previous = current;
+					current = next;
+					x[d * stride + j] = current;
+				}
+			}
+		}
+		row += degree;
+	}
+	if (regression_.payoffInBasis)
+	{
+		std::copy(payoffs, payoffs + count, basis + row * stride);
+	}
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
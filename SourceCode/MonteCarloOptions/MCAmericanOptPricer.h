@@ -0,0 +1,183 @@
+#ifndef MC_AMERICAN_OPT_PRICER_H
+#define MC_AMERICAN_OPT_PRICER_H
+
+#include "MCEuroOptPricer.h"
+#include "MultiAssetPriceGenerator.h"
+#include "MultiAssetPayoffs.h"
+#include <vector>
+#include <span>
+#include <functional>
+
+// Functions of the normalized price x = S / S(0) of each asset, regressed on at every
+// exercise date:
+enum class BasisFunctions
+{
+	MONOMIAL,	// x, x^2, ..., x^degree
+	LAGUERRE	// Weighted Laguerre polynomials e^(-x/2) L_j(x), j = 0, ..., degree - 1, as in Longstaff-Schwartz
+};
+
+// Regression of the continuation value:  a constant, degree functions of each asset, and
+// optionally the payoff itself.  With one asset, a call or put payoff is linear in x where
+// it is in the money, and so adds nothing to the monomials; for baskets it is often the
+// most useful regressor.
+struct RegressionSettings
+{
+	BasisFunctions basis = BasisFunctions::MONOMIAL;
+	int degree = 3;
+	bool payoffInBasis = false;
+};
+
+// American (Bermudan) options by the least-squares Monte Carlo method of Longstaff and
+// Schwartz (2001), on one asset from EquityPriceGenerator or on a basket from
+// MultiAssetPriceGenerator.  Exercise is allowed at every time step t_1, ..., t_n, and at
+// t_0 against the estimated value.
+//
+// The paths are simulated a block of scenarios at a time, step-major, on the thread pool.
+// Each block keeps the discounted cash flow of each of its scenarios and, for each exercise
+// date, only the prices of its scenarios in the money there, the only ones the regression
+// and the exercise decision need; the paths themselves are dropped as soon as the block has
+// been simulated.  Going back from t_(n-1), each date is regressed block by block:  the
+// basis functions of a few hundred in-the-money paths at a time are laid out one function
+// per row, and their cross products accumulated into the normal equations of the block.
+// These are summed in block order, and solved, so the price does not depend on the number
+// of threads.  The same paths are used for the regression and the price.
+//
+// Of the MCSettings, runParallel, numThreads and blockSize are used; only PSEUDO_RANDOM
+// sampling of whole paths is supported, without antithetic variates, the control variate,
+// Greeks, the target error or worker processes.
+class MCAmericanOptPricer
+{
+public:
+	// Single-asset payoff policy (see Payoffs.h), on the paths of EquityPriceGenerator:
+	template<PayoffPolicy Payoff>
+	MCAmericanOptPricer(const Payoff& payoff, double spot, double riskFreeRate, double volatility,
+		double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+		const RegressionSettings& regression = RegressionSettings(), const MCSettings& settings = MCSettings());
+
+	// Multi-asset payoff policy (see MultiAssetPayoffs.h), on the paths of MultiAssetPriceGenerator;
+	// correlation is numAssets x numAssets, row-major:
+	template<MultiAssetPayoffPolicy Payoff>
+	MCAmericanOptPricer(const Payoff& payoff, const std::vector<double>& spots,
+		const std::vector<double>& volatilities, const std::vector<double>& correlation, double riskFreeRate,
+		double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+		const RegressionSettings& regression = RegressionSettings(), const MCSettings& settings = MCSettings());
+
+	double operator()() const;
+	double stdError() const;
+	double time() const;		// Wall-clock seconds for the simulation and the regressions
+	const PricerStats& stats() const;
+
+	// Fraction of the scenarios exercised before expiry:
+	double earlyExerciseFraction() const;
+
+private:
+	using PathGenerator_ = std::function<void(const CounterBasedNormals& rng, int firstScenario, MultiAssetScenarios& paths)>;
+
+	// What the backward induction needs of one block of scenarios:
+	struct Block_
+	{
+		std::vector<double> values;			// Cash flow of each scenario, discounted to t_0
+		std::vector<int> exerciseSteps;		// Time step of that cash flow
+
+		// In-the-money entries of exercise date i are itmBegin[i - 1], ..., itmBegin[i] - 1.  For
+		// the m entries of a date, from entry e:  the scenario in the block, scenarios[e + j],
+		// the payoff discounted to t_0, payoffs[e + j], and the price of asset a,
+		// prices[numAssets * e + a * m + j].
+		std::vector<std::size_t> itmBegin;
+		std::vector<int> scenarios;
+		std::vector<double> payoffs;
+		std::vector<double> prices;
+	};
+
+	void calculate_();
+	void simulateBlock_(const CounterBasedNormals& rng, int block, Block_& paths, PhaseTimes& times) const;
+
+	// Adds the normal equations of the in-the-money paths of a block at exercise date i to
+	// gram (numBasis x numBasis) and rhs (numBasis):
+	void accumulateRegression_(const Block_& paths, int i, double* gram, double* rhs) const;
+	// Exercises where the discounted payoff is at least the regressed continuation value:
+	void exercise_(Block_& paths, int i, const std::vector<double>& coefficients) const;
+
+	int numBasis_() const;
+	// basis[b * stride + j] = function b of entry j, for the count entries at prices (asset a at prices[a * m + j]):
+	void basisFunctions_(const double* prices, std::size_t m, const double* payoffs, std::size_t count,
+		double* basis, std::size_t stride) const;
+
+	MultiAssetEvaluator payoff_;
+	PathGenerator_ paths_;
+	std::vector<double> spots_;
+	double riskFreeRate_;
+	double timeToExpiry_;
+	int numTimeSteps_;
+	int numScenarios_;
+	int initSeed_;
+	double quantity_;
+	RegressionSettings regression_;
+	MCSettings settings_;
+
+	// Computed values:
+	double price_;
+	double stdError_;
+	double earlyExerciseFraction_;
+	PricerStats stats_;
+};
+
+template<PayoffPolicy Payoff>
+MCAmericanOptPricer::MCAmericanOptPricer(const Payoff& payoff, double spot, double riskFreeRate, double volatility,
+	double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+	const RegressionSettings& regression, const MCSettings& settings) :spots_{ spot }, riskFreeRate_(riskFreeRate),
+	timeToExpiry_(timeToExpiry), numTimeSteps_(numTimeSteps), numScenarios_(numScenarios), initSeed_(initSeed),
+	quantity_(quantity), regression_(regression), settings_(settings)
+{
+	payoff_ = [payoff](std::span<const double> prices, std::size_t n, double* payoffs)
+	{
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			payoffs[k] = payoff(prices[k]);
+		}
+	};
+	// With one asset, step-major paths are already in the layout of MultiAssetScenarios:
+	EquityPriceGenerator epg(spot, numTimeSteps, timeToExpiry, riskFreeRate, volatility);
+	paths_ = [epg](const CounterBasedNormals& rng, int firstScenario, MultiAssetScenarios& paths)
+	{
+		ScenarioMatrix block(paths.numScenarios(), paths.numPrices(), PathLayout::STEP_MAJOR);
+		epg(rng, firstScenario, block);
+		std::copy(block.data().begin(), block.data().end(), paths.prices(0, 0).data());
+	};
+	calculate_();
+}
+
+template<MultiAssetPayoffPolicy Payoff>
+MCAmericanOptPricer::MCAmericanOptPricer(const Payoff& payoff, const std::vector<double>& spots,
+	const std::vector<double>& volatilities, const std::vector<double>& correlation, double riskFreeRate,
+	double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+	const RegressionSettings& regression, const MCSettings& settings) :spots_(spots), riskFreeRate_(riskFreeRate),
+	timeToExpiry_(timeToExpiry), numTimeSteps_(numTimeSteps), numScenarios_(numScenarios), initSeed_(initSeed),
+	quantity_(quantity), regression_(regression), settings_(settings)
+{
+	payoff_ = makeMultiAssetEvaluator(payoff, spots.size());
+	MultiAssetPriceGenerator generator(spots, volatilities, correlation, numTimeSteps, timeToExpiry, riskFreeRate);
+	paths_ = [generator](const CounterBasedNormals& rng, int firstScenario, MultiAssetScenarios& paths)
+	{
+		generator(rng, firstScenario, paths);
+	};
+	calculate_();
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,192 @@
+#include "MCBookPricer.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+
+using std::vector;
+
+MCBookPricer::MCBookPricer(const vector<OptionPosition>& positions, double spot, double riskFreeRate,
+	double volatility, double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed,
+	const MCSettings& settings) :positions_(positions), spot_(spot), riskFreeRate_(riskFreeRate),
+	volatility_(volatility), timeToExpiry_(timeToExpiry), numTimeSteps_(numTimeSteps),
+	numScenarios_(numScenarios), initSeed_(initSeed), settings_(settings)
+{
+	if (positions_.empty())
+	{
+		throw std::invalid_argument("MCBookPricer: at least one position is required");
+	}
+	if (settings_.sampling != SamplingScheme::PSEUDO_RANDOM)
+	{
+		throw std::invalid_argument("MCBookPricer: only PSEUDO_RANDOM sampling is supported");
+	}
+	if (settings_.controlVariate || settings_.computeGreeks || settings_.targetStdError > 0.0)
+	{
+		throw std::invalid_argument("MCBookPricer: control variate, Greeks and target error are not supported");
+	}
+	if (settings_.numProcesses > 1 || settings_.variateCache != VariateCache::NONE ||
+		settings_.pathPrecision != PathPrecision::DOUBLE || settings_.onProgress || settings_.stopToken.stop_possible())
+	{
+		throw std::invalid_argument("MCBookPricer: worker processes, variateCache, pathPrecision, onProgress and "
+			"stopToken are not supported");
+	}
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+	calculate_();
+}
+
+int MCBookPricer::numPositions() const
+{
+	return static_cast<int>(positions_.size());
+}
+
+double MCBookPricer::price(int position) const
+{
+	return prices_.at(position);
+}
+
+double MCBookPricer::stdError(int position) const
+{
+	return stdErrors_.at(position);
+}
+
+const vector<double>& MCBookPricer::prices() const
+{
+	return prices_;
+}
+
+double MCBookPricer::bookValue() const
+{
+	return bookValue_;
+}
+
+double MCBookPricer::bookStdError() const
+{
+	return bookStdError_;
+}
+
+double MCBookPricer::time() const
+{
+	return stats_.wallTime;
+}
+
+const PricerStats& MCBookPricer::stats() const
+{
+	return stats_;
+}
+
+void MCBookPricer::calculate_()
+{
+	stats_ = PricerStats();
+	RunTimer runTimer;
+
+	std::optional<ScopedTimer> setupTimer(std::in_place, stats_.phases.setup);
+	EquityPriceGenerator epg(spot_, numTimeSteps_, timeToExpiry_, riskFreeRate_, volatility_);
+	CounterBasedNormals rng(initSeed_);
+	CounterBasedNormals antitheticRng(initSeed_, true);
+
+	// One statistic per position plus one for the whole book, for each block:
+	const int numStats = numPositions() + 1;
+	int numBlocks = (numScenarios_ + settings_.blockSize - 1) / settings_.blockSize;
+	vector<RunningStats> blockStats(static_cast<std::size_t>(numBlocks) * numStats);
+	vector<PhaseTimes> blockTimes(numBlocks);
+	ThreadPool* pool = settings_.runParallel ? &ThreadPool::shared(settings_.numThreads) : nullptr;
+	setupTimer.reset();
+
+	auto priceBlock = [this, &epg, &rng, &antitheticRng, &blockStats, &blockTimes, numStats](int block)
+	{
+		priceBlock_(epg, rng, antitheticRng, block, blockStats.data() + static_cast<std::size_t>(block) * numStats,
+			blockTimes[block]);
+	};
+	forEachTask(pool, numBlocks, priceBlock);
+
+	// Merge in block order, so the results do not depend on the number of threads:
+	std::optional<ScopedTimer> reductionTimer(std::in_place, stats_.phases.reduction);
+	vector<RunningStats> stats(numStats);
+	for (int block = 0; block < numBlocks; ++block)
+	{
+		for (int i = 0; i < numStats; ++i)
+		{
+			stats[i].merge(blockStats[static_cast<std::size_t>(block) * numStats + i]);
+		}
+		stats_.phases.merge(blockTimes[block]);
+	}
+
+	prices_.resize(numPositions());
+	stdErrors_.resize(numPositions());
+	for (int i = 0; i < numPositions(); ++i)
+	{
+		prices_[i] = positions_[i].quantity * stats[i].mean();
+		stdErrors_[i] = std::abs(positions_[i].quantity) * stats[i].stdError();
+	}
+	bookValue_ = stats.back().mean();
+	bookStdError_ = stats.back().stdError();
+	reductionTimer.reset();
+
+	stats_.numPaths = static_cast<long long>(numScenarios_) * (settings_.antithetic ? 2 : 1);
+	runTimer.stop(stats_);
+}
+
+void MCBookPricer::priceBlock_(const EquityPriceGenerator& epg, const CounterBasedNormals& rng,
+	const CounterBasedNormals& antitheticRng, int block, RunningStats* stats, PhaseTimes& times) const
+{
+	int first = block * settings_.blockSize;
+	int n = std::min(first + settings_.blockSize, numScenarios_) - first;
+
+	// The terminal prices of the block are generated once for all positions:
+	vector<double> terminalPrices(n), antitheticPrices(settings_.antithetic ? n : 0);
+	{
+		ScopedTimer timer(times.pathGeneration);
+		epg.terminalPrices(rng, first, terminalPrices, settings_.terminalSampling);
+		if (settings_.antithetic)
+		{
+			epg.terminalPrices(antitheticRng, first, antitheticPrices, settings_.terminalSampling);
+		}
+	}
+
+	// Payoff of a call, or of a put with sign = -1:  max(sign * (S - K), 0)
+	ScopedTimer timer(times.payoffEvaluation);
+	vector<double> payoffs(n), bookPayoffs(n, 0.0);
+	for (int i = 0; i < numPositions(); ++i)
+	{
+		const OptionPosition& position = positions_[i];
+		double sign = (position.optionType == OptionType::CALL) ? 1.0 : -1.0;
+		double strike = position.strike;
+		double scale = settings_.antithetic ? 0.5 * discFactor_ : discFactor_;
+
+		for (int k = 0; k < n; ++k)
+		{
+			payoffs[k] = scale * std::max(sign * (terminalPrices[k] - strike), 0.0);
+		}
+		if (settings_.antithetic)
+		{
+			for (int k = 0; k < n; ++k)
+			{
+				payoffs[k] += scale * std::max(sign * (antitheticPrices[k] - strike), 0.0);
+			}
+		}
+		stats[i].addBlock(payoffs.data(), payoffs.size());
+
+		for (int k = 0; k < n; ++k)
+		{
+			bookPayoffs[k] += position.quantity * payoffs[k];
+		}
+	}
+	stats[numPositions()].addBlock(bookPayoffs.data(), bookPayoffs.size());
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
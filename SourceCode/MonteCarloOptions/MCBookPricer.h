@@ -0,0 +1,84 @@
+#ifndef MC_BOOK_PRICER_H
+#define MC_BOOK_PRICER_H
+
+#include "MCEuroOptPricer.h"
+#include <vector>
+
+struct OptionPosition
+{
+	double strike;
+	OptionType optionType;
+	double quantity;	// Number of contracts
+};
+
+// Prices a book of European options on one underlying and expiry from a single set of
+// simulated terminal prices:  each block of scenarios is generated once, and then every
+// position's payoff is evaluated over the whole block in a branch-free inner loop.
+// Scenarios use the same counter-based variates as MCEuroOptPricer with PSEUDO_RANDOM
+// sampling, so with the same seed and settings each position's price agrees, up to rounding,
+// with that of an MCEuroOptPricer for it alone.
+//
+// Of the MCSettings, runParallel, numThreads, blockSize, terminalSampling and antithetic
+// are used; the other sampling schemes, the control variate, Greeks, the target error,
+// worker processes, variateCache, single-precision paths and progress reporting are not
+// supported by the book pricer, and the constructor throws std::invalid_argument for them.
+class MCBookPricer
+{
+public:
+	MCBookPricer(const std::vector<OptionPosition>& positions, double spot, double riskFreeRate,
+		double volatility, double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed,
+		const MCSettings& settings = MCSettings());
+
+	int numPositions() const;
+	double price(int position) const;		// Including the position's quantity
+	double stdError(int position) const;
+	const std::vector<double>& prices() const;
+
+	// Value of the whole book, with the standard error of the sum of correlated positions:
+	double bookValue() const;
+	double bookStdError() const;
+
+	double time() const;		// Wall-clock seconds for the simulation
+	const PricerStats& stats() const;
+
+private:
+	void calculate_();
+	void priceBlock_(const EquityPriceGenerator& epg, const CounterBasedNormals& rng,
+		const CounterBasedNormals& antitheticRng, int block, RunningStats* stats, PhaseTimes& times) const;
+
+	std::vector<OptionPosition> positions_;
+	double spot_;
+	double riskFreeRate_;
+	double volatility_;
+	double timeToExpiry_;
+	int numTimeSteps_;
+	int numScenarios_;
+	int initSeed_;
+	MCSettings settings_;
+
+	// Computed values:
+	double discFactor_;
+	std::vector<double> prices_;
+	std::vector<double> stdErrors_;
+	double bookValue_;
+	double bookStdError_;
+	PricerStats stats_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
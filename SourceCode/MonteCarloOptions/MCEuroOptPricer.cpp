@@ -1,20 +1,39 @@
 #include "MCEuroOptPricer.h"
 #include "EquityPriceGenerator.h"
+#include "ThreadPool.h"
+#include "InverseNormal.h"
+#include "WorkerProcesses.h"
+#include "GbmKernel.h"
 #include <vector>
 #include <algorithm>
-#include <numeric>
 #include <cmath>
-#include <future>
-#include <ctime>
 #include <limits>
+#include <stdexcept>
+#include <optional>
+#include <cstring>
+#include <type_traits>
 
 MCEuroOptPricer::MCEuroOptPricer(double strike, double spot, double riskFreeRate, double volatility,
 	double timeToExpiry, OptionType porc, int numTimeSteps, int numScenarios,
-	bool runParallel, int initSeed, double quantity) :strike_(strike), spot_(spot),
-	riskFreeRate_(riskFreeRate), volatility_(volatility), timeToExpiry_(timeToExpiry), porc_(porc),
-	numTimeSteps_(numTimeSteps), numScenarios_(numScenarios), runParallel_(runParallel),
+	bool runParallel, int initSeed, double quantity) :spot_(spot),
+	riskFreeRate_(riskFreeRate), volatility_(volatility), timeToExpiry_(timeToExpiry),
+	numTimeSteps_(numTimeSteps), numScenarios_(numScenarios),
 	initSeed_(initSeed), quantity_(quantity)
 {
+	settings_.runParallel = runParallel;
+	setVanillaPayoff_(strike, porc);
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+	calculate_();
+}
+
+MCEuroOptPricer::MCEuroOptPricer(double strike, double spot, double riskFreeRate, double volatility,
+	double timeToExpiry, OptionType porc, int numTimeSteps, int numScenarios,
+	int initSeed, double quantity, const MCSettings& settings) :spot_(spot),
+	riskFreeRate_(riskFreeRate), volatility_(volatility), timeToExpiry_(timeToExpiry),
+	numTimeSteps_(numTimeSteps), numScenarios_(numScenarios),
+	initSeed_(initSeed), quantity_(quantity), settings_(settings)
+{
+	setVanillaPayoff_(strike, porc);
 	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
 	calculate_();
 }
@@ -26,105 +45,709 @@ double MCEuroOptPricer::operator()() const
 
 double MCEuroOptPricer::time() const
 {
-	return time_;
+	return stats_.wallTime;
 }
 
-void MCEuroOptPricer::calculate_()
+double MCEuroOptPricer::stdError() const
 {
-	std::clock_t begin = std::clock();		// begin time with threads
-	computePrice_();
-	std::clock_t end = std::clock();		// end time with threads
-	time_ = double(end - begin) / CLOCKS_PER_SEC;
+	return stdError_;
 }
 
-// Private helper functions:
-void MCEuroOptPricer::computePrice_()
+int MCEuroOptPricer::scenariosUsed() const
+{
+	return scenariosUsed_;
+}
+
+bool MCEuroOptPricer::cancelled() const
+{
+	return cancelled_;
+}
+
+ConfidenceInterval MCEuroOptPricer::confidenceInterval(double level) const
 {
-	if (runParallel_)
+	if (!(level > 0.0 && level < 1.0))
 	{
-		computePriceAsync_();			
+		throw std::invalid_argument("MCEuroOptPricer: confidence level must be in (0, 1)");
 	}
-	else
+	double halfWidth = inverseNormalCdf(0.5 + 0.5 * level) * stdError_;
+	return { price_ - halfWidth, price_ + halfWidth };
+}
+
+const PricerStats& MCEuroOptPricer::stats() const
+{
+	return stats_;
+}
+
+double MCEuroOptPricer::reprice(const MarketInputs& inputs)
+{
+	if (store_)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: reprice(.) needs simulated scenarios, not stored ones");
+	}
+	if (sdePaths_)
 	{
-		computePriceNoParallel_();		
+		throw std::invalid_argument("MCEuroOptPricer: reprice(.) is not available on an SdeEngine");
 	}
+	spot_ = inputs.spot;
+	riskFreeRate_ = inputs.riskFreeRate;
+	volatility_ = inputs.volatility;
+	timeToExpiry_ = inputs.timeToExpiry;
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+	cancelled_ = false;
+	calculate_();
+	return price_;
 }
 
-void MCEuroOptPricer::computePriceNoParallel_()
+MarketInputs MCEuroOptPricer::marketInputs() const
 {
-	EquityPriceGenerator epg(spot_, numTimeSteps_, timeToExpiry_, riskFreeRate_, volatility_);
-	generateSeeds_();
-	std::vector<double> discountedPayoffs;
-	discountedPayoffs.reserve(numScenarios_);
+	return { spot_, riskFreeRate_, volatility_, timeToExpiry_ };
+}
 
-	for (auto& seed : seeds_)
+void MCEuroOptPricer::initFromStore_()
+{
+	if (settings_.sampling != SamplingScheme::PSEUDO_RANDOM || settings_.antithetic || settings_.terminalSampling ||
+		settings_.computeGreeks || settings_.variateCache != VariateCache::NONE ||
+		settings_.pathPrecision != PathPrecision::DOUBLE)
 	{
-		double terminalPrice = (epg(seed)).back();
-		double payoff = payoff_(terminalPrice);
+		throw std::invalid_argument("MCEuroOptPricer: stored scenarios need PSEUDO_RANDOM settings without antithetic, "
+			"terminalSampling, computeGreeks, variateCache or pathPrecision");
+	}
 
-		discountedPayoffs.push_back(discFactor_ * payoff);
+	// Equivalent constant rate and volatility, for the record:  the store's own tables are
+	// used for the discount factor and the path steps.
+	spot_ = store_->initPrice();
+	timeToExpiry_ = store_->times().back();
+	numTimeSteps_ = store_->numTimeSteps();
+	numScenarios_ = store_->numScenarios();
+	discFactor_ = store_->discountFactor();
+	riskFreeRate_ = -std::log(discFactor_) / timeToExpiry_;
+	double variance = 0.0;
+	for (double diffusion : store_->stepDiffusions())
+	{
+		variance += diffusion * diffusion;
 	}
+	volatility_ = std::sqrt(variance / timeToExpiry_);
+}
 
-	// numScenarios_ should = discountedPayoffs.size()
-	double numScens = static_cast<double>(numScenarios_);
-	price_ = quantity_ * (1.0 / numScens) * 
-		std::accumulate(discountedPayoffs.begin(), discountedPayoffs.end(), 0.0);
+void MCEuroOptPricer::checkSdeSettings_() const
+{
+	if (settings_.sampling != SamplingScheme::PSEUDO_RANDOM || settings_.terminalSampling ||
+		settings_.computeGreeks || settings_.variateCache != VariateCache::NONE ||
+		settings_.pathPrecision != PathPrecision::DOUBLE)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: an SdeEngine needs PSEUDO_RANDOM settings without "
+			"terminalSampling, computeGreeks, variateCache or pathPrecision");
+	}
 }
 
-void MCEuroOptPricer::computePriceAsync_()
+void MCEuroOptPricer::calculate_()
 {
-	EquityPriceGenerator epg(spot_, numTimeSteps_, timeToExpiry_, riskFreeRate_, volatility_);
-	generateSeeds_();
+	// std::clock() would add up the CPU time of every thread, so the wall-clock time is
+	// measured separately:
+	stats_ = PricerStats();
+	RunTimer timer(dynamic_cast<const CountingResource*>(settings_.memoryResource));
+	computePrice_();
+	stats_.numPaths = static_cast<long long>(scenariosUsed_) * (settings_.antithetic ? 2 : 1);
+	timer.stop(stats_);
+}
+
+// Kept between pricing calls, so that repricing allocates nothing once the arenas have grown:
+struct MCEuroOptPricer::Workspace_
+{
+	Workspace_(std::pmr::memory_resource* upstream, bool threaded, unsigned numThreads);
 
-	using realVector = std::vector<double>;		
-	std::vector<std::future<realVector> > futures;
-	futures.reserve(numScenarios_);
+	std::unique_ptr<ThreadPool> pool;
+	Arena runArena;		// Statistics and tables of a whole run, on the calling thread
+	std::vector<std::unique_ptr<Arena>> blockArenas;	// One per worker, then one for the calling thread
+};
 
-	for (auto& seed : seeds_)
+MCEuroOptPricer::Workspace_::Workspace_(std::pmr::memory_resource* upstream, bool threaded, unsigned numThreads) :
+	runArena(upstream)
+{
+	if (threaded)
+	{
+		pool = std::make_unique<ThreadPool>(numThreads);
+	}
+	unsigned numArenas = (pool ? pool->size() : 0) + 1;
+	for (unsigned i = 0; i < numArenas; ++i)
 	{
-		futures.push_back(std::async(epg, seed));
+		blockArenas.push_back(std::make_unique<Arena>(upstream));
 	}
+}
+
+void MCEuroOptPricer::deleteWorkspace_(Workspace_* workspace)
+{
+	delete workspace;
+}
 
-	realVector discountedPayoffs;
-	discountedPayoffs.reserve(numScenarios_);
+Arena& MCEuroOptPricer::blockArena_() const
+{
+	int worker = workspace_->pool ? workspace_->pool->workerIndex() : -1;
+	return (worker < 0) ? *workspace_->blockArenas.back() : *workspace_->blockArenas[worker];
+}
 
-	for (auto& future : futures)
+MCEuroOptPricer::Simulation_::Simulation_(const MCEuroOptPricer& pricer, std::pmr::memory_resource* resource) :
+	epg(pricer.spot_, pricer.numTimeSteps_, pricer.timeToExpiry_, pricer.riskFreeRate_, pricer.volatility_, resource),
+	rng(pricer.initSeed_), antitheticRng(pricer.initSeed_, true)
+{
+	if (pricer.settings_.sampling == SamplingScheme::PSEUDO_RANDOM)
+	{
+		return;
+	}
+
+	// With the Brownian bridge, the first dimensions of each Sobol point determine the
+	// coarse shape of the path; exact terminal sampling needs only one dimension.
+	unsigned dimension = pricer.settings_.terminalSampling ? 1 : pricer.numTimeSteps_;
+	sobol = std::make_unique<SobolSequence>(dimension);
+	if (!pricer.settings_.terminalSampling)
 	{
-		double terminalPrice = future.get().back();		
-		double payoff = payoff_(terminalPrice);
-		discountedPayoffs.push_back(discFactor_ * payoff);
+		bridge = std::make_unique<BrownianBridge>(pricer.numTimeSteps_, pricer.timeToExpiry_);
 	}
 
-	double numScens = static_cast<double>(numScenarios_);
-	price_ = quantity_ * (1.0 / numScens) *
-		std::accumulate(discountedPayoffs.begin(), discountedPayoffs.end(), 0.0);
+	if (pricer.settings_.sampling == SamplingScheme::SCRAMBLED_SOBOL)
+	{
+		// Random digital shifts, taken from a Philox counter range the normal variates never use:
+		int numReps = pricer.numReplications_();
+		shifts.resize(static_cast<std::size_t>(numReps) * dimension);
+		Philox4x32::Key key{ static_cast<std::uint32_t>(pricer.initSeed_),
+			static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::int64_t>(pricer.initSeed_)) >> 32) };
+		for (int r = 0; r < numReps; ++r)
+		{
+			for (unsigned d = 0; d < dimension; ++d)
+			{
+				Philox4x32::Counter ctr{ d, static_cast<std::uint32_t>(r), 0xFFFFFFFFu, 0xFFFFFFFFu };
+				shifts[r * dimension + d] = Philox4x32::generate(ctr, key)[0];
+			}
+		}
+	}
 }
 
-void MCEuroOptPricer::generateSeeds_()
+const MCGreeks& MCEuroOptPricer::greeks() const
 {
-	seeds_.resize(numScenarios_);
-
-	// This is a contrived way of setting a different seed for 
-	// each scenario.  There are more robust ways to do this if desired.
-	std::iota(seeds_.begin(), seeds_.end(), initSeed_);
+	return greeks_;
 }
 
-double MCEuroOptPricer::payoff_(double terminalPrice)
+// Private helper functions:
+void MCEuroOptPricer::setVanillaPayoff_(double strike, OptionType porc)
 {
-	double payoff = 0.0;
-	switch (porc_)
+	switch (porc)
 	{
 	case OptionType::CALL:
-		payoff = std::max(terminalPrice - strike_, 0.0);
+		setPayoff_(CallPayoff{ strike });
 		break;
 	case OptionType::PUT:
-		payoff = std::max(strike_ - terminalPrice, 0.0);
+		setPayoff_(PutPayoff{ strike });
 		break;
 	default:	// This case should NEVER happen
-		payoff = std::numeric_limits<double>::quiet_NaN();
-		break;
+		throw std::invalid_argument("MCEuroOptPricer: unknown option type");
+	}
+}
+
+void MCEuroOptPricer::ScenarioStats_::merge(const ScenarioStats_& other)
+{
+	payoff.merge(other.payoff);
+	delta.merge(other.delta);
+	gamma.merge(other.gamma);
+	vega.merge(other.vega);
+	rho.merge(other.rho);
+}
+
+void MCEuroOptPricer::computePrice_()
+{
+	if (settings_.targetStdError > 0.0 && settings_.sampling == SamplingScheme::SOBOL)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: targetStdError needs PSEUDO_RANDOM or SCRAMBLED_SOBOL sampling");
+	}
+	if (settings_.pathPrecision != PathPrecision::DOUBLE && settings_.sampling != SamplingScheme::PSEUDO_RANDOM)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: single-precision paths need PSEUDO_RANDOM sampling");
+	}
+	if (settings_.pathPrecision != PathPrecision::DOUBLE && settings_.variateCache != VariateCache::NONE)
+	{
+		// Cached blocks are repriced in double, and would not match the first run:
+		throw std::invalid_argument("MCEuroOptPricer: single-precision paths cannot be used with variateCache");
+	}
+
+	std::optional<ScopedTimer> setupTimer(std::in_place, stats_.phases.setup);
+	// No pool when sharding:  worker processes are forked from this thread only.
+	bool sharded = settings_.numProcesses > 1;
+	if (!workspace_)
+	{
+		workspace_.reset(new Workspace_(settings_.memoryResource ? settings_.memoryResource : std::pmr::get_default_resource(),
+			settings_.runParallel && !sharded, settings_.numThreads));
+	}
+	Arena& runArena = workspace_->runArena;
+	runArena.reset();
+	runArena.resetPeak();
+	for (auto& arena : workspace_->blockArenas)
+	{
+		arena->resetPeak();
+	}
+	Simulation_ sim(*this, &runArena);
+	int numReps = numReplications_();
+	int numBlocks = (numScenarios_ + settings_.blockSize - 1) / settings_.blockSize;
+
+	// Without a target error or progress reports all blocks are run in one round:
+	bool rounds = settings_.targetStdError > 0.0 || settings_.onProgress || settings_.stopToken.stop_possible();
+	int blocksPerRound = rounds ? std::max(settings_.blocksPerCheck, 1) : numBlocks;
+	ThreadPool* pool = workspace_->pool.get();
+	if (settings_.variateCache == VariateCache::TERMINAL && variateCache_.size() != static_cast<std::size_t>(numBlocks))
+	{
+		variateCache_.assign(numBlocks, std::vector<double>());
+	}
+	setupTimer.reset();
+
+	std::pmr::vector<ScenarioStats_> repStats(numReps, &runArena);
+	std::pmr::vector<ScenarioStats_> blockStats(&runArena);
+	std::pmr::vector<PhaseTimes> blockTimes(&runArena);
+	int block = 0;
+	while (block < numBlocks)
+	{
+		int roundBlocks = std::min(blocksPerRound, numBlocks - block);
+		blockStats.assign(static_cast<std::size_t>(roundBlocks) * numReps, ScenarioStats_());
+		blockTimes.assign(roundBlocks, PhaseTimes());
+		if (sharded)
+		{
+			computePriceSharded_(sim, block, blockStats, blockTimes);
+		}
+		else if (pool)
+		{
+			computePriceParallel_(sim, *pool, block, blockStats, blockTimes);
+		}
+		else
+		{
+			computePriceNoParallel_(sim, block, blockStats, blockTimes);
+		}
+
+		{
+			ScopedTimer reductionTimer(stats_.phases.reduction);
+			for (int b = 0; b < roundBlocks; ++b)
+			{
+				for (int r = 0; r < numReps; ++r)
+				{
+					repStats[r].merge(blockStats[b * numReps + r]);
+				}
+				stats_.phases.merge(blockTimes[b]);
+			}
+			estimate_(repStats);
+		}
+		block += roundBlocks;
+		int scenariosDone = std::min(block * settings_.blockSize, numScenarios_);
+
+		// Time spent in onProgress is not attributed to any phase:
+		bool finished = block == numBlocks ||
+			(settings_.targetStdError > 0.0 && stdError_ <= settings_.targetStdError);
+		bool proceed = !settings_.onProgress || settings_.onProgress(ProgressUpdate{ scenariosDone, price_, stdError_ });
+		if (finished)
+		{
+			break;
+		}
+		if (!proceed || settings_.stopToken.stop_requested())
+		{
+			cancelled_ = true;
+			break;
+		}
+	}
+	scenariosUsed_ = std::min(block * settings_.blockSize, numScenarios_);
+
+	stats_.peakBytes = static_cast<long long>(runArena.peakBytes());
+	for (auto& arena : workspace_->blockArenas)
+	{
+		stats_.peakBytes += static_cast<long long>(arena->peakBytes());
+	}
+}
+
+void MCEuroOptPricer::estimate_(const std::pmr::vector<ScenarioStats_>& repStats)
+{
+	RunningCovariance total;
+	for (const ScenarioStats_& stats : repStats)
+	{
+		total.merge(stats.payoff);
+	}
+
+	// Control variate coefficient, beta = Cov(x, y) / Var(x), fitted on all scenarios:
+	double beta = 0.0;
+	if (settings_.controlVariate && total.count() > 1.0 && total.varianceX() > 0.0)
+	{
+		beta = total.covariance() / total.varianceX();
+	}
+
+	auto estimate = [this, beta](const RunningCovariance& stats)
+	{
+		return quantity_ * (stats.meanY() - beta * (stats.meanX() - spot_));
+	};
+	price_ = estimate(total);
+
+	stdError_ = std::numeric_limits<double>::quiet_NaN();
+	int numReps = static_cast<int>(repStats.size());
+	if (numReps > 1)
+	{
+		// Each replication is an independent, unbiased estimate of the price:
+		RunningStats estimates;
+		for (const ScenarioStats_& stats : repStats)
+		{
+			estimates.add(estimate(stats.payoff));
+		}
+		stdError_ = estimates.stdError();
+	}
+	else if (settings_.sampling == SamplingScheme::PSEUDO_RANDOM && total.count() > 1.0)
+	{
+		// Sample variance of the residuals y - beta * x:
+		double varResidual = total.varianceY() - 2.0 * beta * total.covariance() + beta * beta * total.varianceX();
+		stdError_ = std::abs(quantity_) * std::sqrt(std::max(varResidual, 0.0) / total.count());
+	}
+
+	double nan = std::numeric_limits<double>::quiet_NaN();
+	greeks_ = { {nan, nan}, {nan, nan}, {nan, nan}, {nan, nan} };
+	if (settings_.computeGreeks)
+	{
+		greeks_.delta = estimateGreek_(repStats, &ScenarioStats_::delta);
+		greeks_.gamma = estimateGreek_(repStats, &ScenarioStats_::gamma);
+		greeks_.vega = estimateGreek_(repStats, &ScenarioStats_::vega);
+		greeks_.rho = estimateGreek_(repStats, &ScenarioStats_::rho);
+	}
+}
+
+GreekEstimate MCEuroOptPricer::estimateGreek_(const std::pmr::vector<ScenarioStats_>& repStats,
+	RunningStats ScenarioStats_::* greek) const
+{
+	RunningStats total;
+	for (const ScenarioStats_& stats : repStats)
+	{
+		total.merge(stats.*greek);
+	}
+
+	GreekEstimate result{ quantity_ * total.mean(), std::numeric_limits<double>::quiet_NaN() };
+	if (repStats.size() > 1)
+	{
+		RunningStats estimates;
+		for (const ScenarioStats_& stats : repStats)
+		{
+			estimates.add(quantity_ * (stats.*greek).mean());
+		}
+		result.stdError = estimates.stdError();
+	}
+	else if (settings_.sampling == SamplingScheme::PSEUDO_RANDOM)
+	{
+		result.stdError = std::abs(quantity_) * total.stdError();
 	}
-	return payoff;
+	return result;
+}
+
+int MCEuroOptPricer::numReplications_() const
+{
+	return settings_.sampling == SamplingScheme::SCRAMBLED_SOBOL ? settings_.numReplications : 1;
+}
+
+void MCEuroOptPricer::computePriceNoParallel_(const Simulation_& sim, int firstBlock,
+	std::pmr::vector<ScenarioStats_>& blockStats, std::pmr::vector<PhaseTimes>& blockTimes) const
+{
+	int numReps = numReplications_();
+	for (int b = 0; b < static_cast<int>(blockTimes.size()); ++b)
+	{
+		priceBlock_(sim, firstBlock + b, blockStats.data() + b * numReps, blockTimes[b]);
+	}
+}
+
+void MCEuroOptPricer::computePriceParallel_(const Simulation_& sim, ThreadPool& pool, int firstBlock,
+	std::pmr::vector<ScenarioStats_>& blockStats, std::pmr::vector<PhaseTimes>& blockTimes) const
+{
+	// Each worker prices whole blocks of scenarios and returns only their statistics,
+	// so memory does not grow with the number of scenarios and there is one task
+	// per block rather than one per scenario.
+	int numReps = numReplications_();
+	pool.parallelFor(static_cast<int>(blockTimes.size()),
+		[this, &sim, &blockStats, &blockTimes, numReps, firstBlock](int b)
+	{
+		priceBlock_(sim, firstBlock + b, blockStats.data() + b * numReps, blockTimes[b]);
+	});
+}
+
+void MCEuroOptPricer::computePriceSharded_(const Simulation_& sim, int firstBlock,
+	std::pmr::vector<ScenarioStats_>& blockStats, std::pmr::vector<PhaseTimes>& blockTimes) const
+{
+	// The record of a shard is the statistics and timings of its blocks, copied as raw bytes:
+	// the workers run this same binary, so the layout matches and the values are exact.
+	static_assert(std::is_trivially_copyable_v<ScenarioStats_> && std::is_trivially_copyable_v<PhaseTimes>);
+
+	const int numReps = numReplications_();
+	const int numBlocks = static_cast<int>(blockTimes.size());
+	const int numShards = std::min(settings_.numProcesses, numBlocks);
+	auto shardBegin = [numBlocks, numShards](int shard)
+	{
+		return static_cast<int>(static_cast<long long>(numBlocks) * shard / numShards);
+	};
+	auto recordSize = [numReps](int shardBlocks)
+	{
+		return static_cast<std::size_t>(shardBlocks) * (numReps * sizeof(ScenarioStats_) + sizeof(PhaseTimes));
+	};
+
+	std::vector<std::vector<std::byte>> records = runWorkerProcesses(numShards,
+		[this, &sim, firstBlock, numReps, &shardBegin, &recordSize](int shard)
+	{
+		int begin = shardBegin(shard);
+		int shardBlocks = shardBegin(shard + 1) - begin;
+		std::vector<ScenarioStats_> stats(static_cast<std::size_t>(shardBlocks) * numReps);
+		std::vector<PhaseTimes> times(shardBlocks);
+		for (int b = 0; b < shardBlocks; ++b)
+		{
+			priceBlock_(sim, firstBlock + begin + b, stats.data() + b * numReps, times[b]);
+		}
+
+		std::vector<std::byte> record(recordSize(shardBlocks));
+		std::size_t statsBytes = stats.size() * sizeof(ScenarioStats_);
+		std::memcpy(record.data(), stats.data(), statsBytes);
+		std::memcpy(record.data() + statsBytes, times.data(), times.size() * sizeof(PhaseTimes));
+		return record;
+	});
+
+	for (int shard = 0; shard < numShards; ++shard)
+	{
+		int begin = shardBegin(shard);
+		int shardBlocks = shardBegin(shard + 1) - begin;
+		const std::vector<std::byte>& record = records[shard];
+		if (record.size() != recordSize(shardBlocks))
+		{
+			throw std::runtime_error("MCEuroOptPricer: malformed record from worker process");
+		}
+		std::size_t statsBytes = static_cast<std::size_t>(shardBlocks) * numReps * sizeof(ScenarioStats_);
+		std::memcpy(blockStats.data() + static_cast<std::size_t>(begin) * numReps, record.data(), statsBytes);
+		std::memcpy(blockTimes.data() + begin, record.data() + statsBytes, shardBlocks * sizeof(PhaseTimes));
+	}
+}
+
+void MCEuroOptPricer::priceBlock_(const Simulation_& sim, int block, ScenarioStats_* stats, PhaseTimes& times) const
+{
+	int first = block * settings_.blockSize;
+	int last = std::min(first + settings_.blockSize, numScenarios_);
+
+	// Nothing allocated for the previous block on this thread is still in use:
+	Arena& arena = blockArena_();
+	arena.reset();
+
+	if (store_ && !pathPayoff_)
+	{
+		// Stored scenarios:  the payoffs read S(T) from the mapped file.
+		std::pmr::vector<double> buffer(&arena);
+		std::span<const double> storedPrices;
+		{
+			ScopedTimer timer(times.pathGeneration);
+			storedPrices = storedPrices_(numTimeSteps_, first, last - first, buffer);
+		}
+		ScopedTimer timer(times.payoffEvaluation);
+		payoff_(*this, first, storedPrices, {}, stats);
+		return;
+	}
+
+	// All terminal prices of the block are generated first, and then the payoffs evaluated:
+	std::pmr::vector<double> terminalPrices(last - first, &arena);
+	std::pmr::vector<double> antitheticPrices(settings_.antithetic ? last - first : 0, &arena);
+	if (pathPayoff_)
+	{
+		pathPayoff_(*this, sim, first, terminalPrices, antitheticPrices, stats, times);
+		return;
+	}
+	std::vector<double>* cache = variateCache_.empty() ? nullptr : &variateCache_[block];
+	if (cache && !cache->empty())
+	{
+		// Priced before:  only the transform to S(T) is rerun, under the current inputs.
+		ScopedTimer timer(times.pathGeneration);
+		pricesFromVariates_(cache->data(), terminalPrices);
+		if (settings_.antithetic)
+		{
+			pricesFromVariates_(cache->data() + terminalPrices.size(), antitheticPrices);
+		}
+	}
+	else
+	{
+		ScopedTimer timer(times.pathGeneration);
+		if (settings_.sampling == SamplingScheme::PSEUDO_RANDOM)
+		{
+			if (settings_.pathPrecision == PathPrecision::SINGLE)
+			{
+				pseudoRandomPrices_<float>(sim, first, terminalPrices, antitheticPrices);
+			}
+			else
+			{
+				pseudoRandomPrices_<double>(sim, first, terminalPrices, antitheticPrices);
+			}
+		}
+		else
+		{
+			quasiRandomPrices_(sim, first, terminalPrices, antitheticPrices, &arena);
+		}
+		if (cache)
+		{
+			cache->resize(terminalPrices.size() + antitheticPrices.size());
+			variatesFromPrices_(terminalPrices, cache->data());
+			variatesFromPrices_(antitheticPrices, cache->data() + terminalPrices.size());
+		}
+	}
+
+	ScopedTimer timer(times.payoffEvaluation);
+	payoff_(*this, first, terminalPrices, antitheticPrices, stats);
+}
+
+template<typename Real>
+void MCEuroOptPricer::pseudoRandomPrices_(const Simulation_& sim, int first, std::span<double> prices,
+	std::span<double> antitheticPrices) const
+{
+	// The variates of each scenario depend only on its index, so a block can be
+	// generated on any thread.  Its paths are advanced together, step by step:
+	Arena& arena = blockArena_();
+	if (sdePaths_)
+	{
+		sdePaths_(sim.rng, first, prices, &arena);
+		if (settings_.antithetic)
+		{
+			sdePaths_(sim.antitheticRng, first, antitheticPrices, &arena);
+		}
+	}
+	else if constexpr (std::is_same_v<Real, double>)
+	{
+		sim.epg.terminalPrices(sim.rng, first, prices, settings_.terminalSampling, &arena);
+		if (settings_.antithetic)
+		{
+			sim.epg.terminalPrices(sim.antitheticRng, first, antitheticPrices, settings_.terminalSampling, &arena);
+		}
+	}
+	else
+	{
+		// Simulated in Real, then widened to double for the payoffs:
+		std::pmr::vector<Real> paths(prices.size(), &arena);
+		sim.epg.terminalPrices(sim.rng, first, std::span<Real>(paths), settings_.terminalSampling, &arena);
+		std::copy(paths.begin(), paths.end(), prices.begin());
+		if (settings_.antithetic)
+		{
+			sim.epg.terminalPrices(sim.antitheticRng, first, std::span<Real>(paths), settings_.terminalSampling, &arena);
+			std::copy(paths.begin(), paths.end(), antitheticPrices.begin());
+		}
+	}
+}
+
+void MCEuroOptPricer::quasiRandomPrices_(const Simulation_& sim, int first, std::span<double> prices,
+	std::span<double> antitheticPrices, std::pmr::memory_resource* workspace) const
+{
+	int last = first + static_cast<int>(prices.size());
+	int numReps = numReplications_();
+	const unsigned dim = sim.sobol->dimension();
+
+	// Scenario k is point number k / numReps of replication k % numReps.  Each
+	// replication's first point in the block is computed directly, and the rest by
+	// the cheaper Gray-code update.  Unshifted, point 0 is the origin, whose variates are
+	// all about -6.4 (u = 2^-33):  plain SOBOL starts from point 1 instead.
+	const std::uint64_t firstPoint = sim.shifts.empty() ? 1 : 0;
+	std::pmr::vector<std::uint32_t> points(static_cast<std::size_t>(numReps) * dim, workspace);
+	std::pmr::vector<double> uniforms(dim, workspace), norms(dim, workspace), increments(dim, workspace);
+	std::pmr::vector<double> path(settings_.terminalSampling ? 0 : numTimeSteps_ + 1, workspace);
+
+	auto terminalPrice = [this, &sim, &increments, &path](const std::pmr::vector<double>& norms)
+	{
+		if (settings_.terminalSampling)
+		{
+			return sim.epg.terminalPriceFromNormal(norms[0]);
+		}
+		(*sim.bridge)(norms.data(), increments.data());
+		sim.epg(increments, path);
+		return path.back();
+	};
+
+	for (int scenario = first; scenario < last; ++scenario)
+	{
+		int r = scenario % numReps;
+		std::uint64_t index = scenario / numReps + firstPoint;
+		std::uint32_t* x = points.data() + static_cast<std::size_t>(r) * dim;
+		if (scenario - first < numReps)
+		{
+			sim.sobol->skipTo(index, x);
+		}
+		else
+		{
+			sim.sobol->next(index - 1, x);
+		}
+
+		sim.sobol->toUniforms(x, sim.shifts.empty() ? nullptr : sim.shifts.data() + static_cast<std::size_t>(r) * dim,
+			uniforms.data());
+		inverseNormalCdf(uniforms.data(), norms.data(), uniforms.size());
+
+		prices[scenario - first] = terminalPrice(norms);
+		if (settings_.antithetic)
+		{
+			std::transform(norms.begin(), norms.end(), norms.begin(), [](double z) {return -z; });
+			antitheticPrices[scenario - first] = terminalPrice(norms);
+		}
+	}
+}
+
+std::span<const double> MCEuroOptPricer::storedPrices_(int step, int first, int n, std::pmr::vector<double>& buffer) const
+{
+	if (store_->precision() == PathPrecision::DOUBLE)
+	{
+		return store_->prices<double>(step).subspan(first, n);
+	}
+	std::span<const float> stored = store_->prices<float>(step).subspan(first, n);
+	buffer.assign(stored.begin(), stored.end());
+	return buffer;
+}
+
+void MCEuroOptPricer::replayStoredPaths_(int first, std::span<double> prices, const PathObserver& observer) const
+{
+	const int n = static_cast<int>(prices.size());
+	std::span<const double> times = store_->times();
+	std::pmr::vector<double> prevBuffer(&blockArena_()), nextBuffer(&blockArena_());
+	std::span<const double> prev = storedPrices_(0, first, n, prevBuffer);
+	for (int i = 0; i < numTimeSteps_; ++i)
+	{
+		std::span<const double> next = storedPrices_(i + 1, first, n, nextBuffer);
+		double dt = times[i + 1] - times[i];
+		observer(PathStep{ i + 1, times[i + 1], dt, store_->stepDiffusions()[i] / std::sqrt(dt) }, prev.data(),
+			next.data(), prices.size());
+
+		// Swapping the buffers keeps next (in nextBuffer, if widened) valid as prev:
+		std::swap(prevBuffer, nextBuffer);
+		prev = next;
+	}
+	std::copy(prev.begin(), prev.end(), prices.begin());
+}
+
+void MCEuroOptPricer::pricesFromVariates_(const double* variates, std::span<double> prices) const
+{
+	// S(T) = S(0) exp((r - sigma^2/2) T + sigma sqrt(T) z), z = W(T) / sqrt(T):
+	double drift = (riskFreeRate_ - 0.5 * volatility_ * volatility_) * timeToExpiry_;
+	gbmGrowthFactors(variates, prices.data(), prices.size(), drift, volatility_ * std::sqrt(timeToExpiry_));
+	for (double& price : prices)
+	{
+		price *= spot_;
+	}
+}
+
+void MCEuroOptPricer::variatesFromPrices_(std::span<const double> prices, double* variates) const
+{
+	double drift = (riskFreeRate_ - 0.5 * volatility_ * volatility_) * timeToExpiry_;
+	double diffusion = volatility_ * std::sqrt(timeToExpiry_);
+	for (std::size_t k = 0; k < prices.size(); ++k)
+	{
+		variates[k] = (std::log(prices[k] / spot_) - drift) / diffusion;
+	}
+}
+
+void MCEuroOptPricer::greekEstimators_(double terminalPrice, double payoff, double payoffSlope, double* greeks) const
+{
+	// S(T) = S(0) exp((r - sigma^2/2) T + sigma W(T)) on every path, whatever the number of
+	// time steps, so each estimator is a function of S(T) alone (Glasserman, 7.2 and 7.3).
+	// With g the payoff and g' its slope:
+	//   delta = e^(-rT) g'(S(T)) S(T) / S(0)
+	//   gamma = e^(-rT) g'(S(T)) S(T) / S(0)^2 * (W(T) / (sigma T) - 1)
+	//   vega  = e^(-rT) g'(S(T)) S(T) (W(T) - sigma T)
+	//   rho   = T e^(-rT) (g'(S(T)) S(T) - g(S(T)))
+	double wT = (std::log(terminalPrice / spot_) - (riskFreeRate_ - 0.5 * volatility_ * volatility_) * timeToExpiry_)
+		/ volatility_;
+	double slopeTerm = discFactor_ * payoffSlope * terminalPrice;
+	greeks[0] = slopeTerm / spot_;
+	greeks[1] = (payoffSlope == 0.0) ? 0.0 :
+		slopeTerm / (spot_ * spot_) * (wT / (volatility_ * timeToExpiry_) - 1.0);
+	greeks[2] = (payoffSlope == 0.0) ? 0.0 : slopeTerm * (wT - volatility_ * timeToExpiry_);
+	greeks[3] = timeToExpiry_ * (slopeTerm - discFactor_ * payoff);
 }
 
 /*
@@ -9,58 +9,548 @@
 #define MC_EURO_OPT_PRICER_H
 
 #include "EquityPriceGenerator.h"
-enum class OptionType
+#include "SobolSequence.h"
+#include "BrownianBridge.h"
+#include "RunningStats.h"
+#include "Instrumentation.h"
+#include "Payoffs.h"
+#include "PathPayoffs.h"
+#include "ScenarioStore.h"
+#include "SdeEngine.h"
+#include "Arena.h"
+#include <memory>
+#include <cstdint>
+#include <span>
+#include <functional>
+#include <stdexcept>
+#include <cmath>
+#include <stop_token>
+#include <memory_resource>
+
+class ThreadPool;
+
+enum class SamplingScheme
+{
+	PSEUDO_RANDOM,		// Counter-based (Philox) normal variates
+	SOBOL,				// Sobol points, with Brownian bridge path construction
+	SCRAMBLED_SOBOL		// SOBOL in numReplications independent random digital shifts
+};
+
+struct ConfidenceInterval
+{
+	double lower;
+	double upper;
+};
+
+struct GreekEstimate
+{
+	double value;
+	double stdError;
+};
+
+// What the pricer keeps of its scenarios for MCEuroOptPricer::reprice(.):
+enum class VariateCache
+{
+	NONE,		// Nothing:  the counter-based variates are regenerated, at the full cost of a run
+	TERMINAL	// W(T) / sqrt(T) of each path:  one double per scenario (two if antithetic)
+};
+
+// Market inputs that MCEuroOptPricer::reprice(.) can change:
+struct MarketInputs
+{
+	double spot;
+	double riskFreeRate;
+	double volatility;
+	double timeToExpiry;
+};
+
+// Running estimate after a round of blocks (see MCSettings::onProgress):
+struct ProgressUpdate
+{
+	int scenariosDone;
+	double price;
+	double stdError;
+};
+
+// Sensitivities of the position value (including quantity) to spot, volatility and
+// the risk-free rate, per unit change of each:
+struct MCGreeks
 {
-	CALL,
-	PUT
+	GreekEstimate delta;
+	GreekEstimate gamma;
+	GreekEstimate vega;
+	GreekEstimate rho;
+};
+
+// Engine settings kept separate from the model inputs:
+struct MCSettings
+{
+	bool runParallel = true;
+	unsigned numThreads = 0;	// Size of worker pool; 0 => std::thread::hardware_concurrency()
+	int blockSize = 4096;		// Number of scenarios priced by one task
+	bool terminalSampling = false;	// Sample S(T) exactly in one step; numTimeSteps is then ignored
+	SamplingScheme sampling = SamplingScheme::PSEUDO_RANDOM;
+	int numReplications = 16;		// SCRAMBLED_SOBOL only:  scenario k belongs to replication k % numReplications
+
+	// Variance reduction:
+	bool antithetic = false;		// Each scenario averages the paths driven by z and by -z
+	bool controlVariate = false;	// Control with discounted S(T), whose Black-Scholes mean is S(0)
+
+	// Estimate the Greeks from the same paths as the price:  pathwise delta, vega and rho,
+	// and the mixed likelihood-ratio/pathwise estimator for gamma.  The control variate
+	// is applied to the price only.  Needs a payoff with slope(.) (see Payoffs.h).
+	bool computeGreeks = false;
+
+	// With targetStdError > 0, blocks of scenarios are simulated until stdError() is at most
+	// targetStdError (in the units of the price), and numScenarios is only an upper limit.
+	// The error is checked every blocksPerCheck blocks, so the result does not depend on
+	// the number of threads.
+	double targetStdError = 0.0;
+	int blocksPerCheck = 4;
+
+	// With numProcesses > 1, the blocks of each round are split into numProcesses contiguous
+	// shards, priced by forked worker processes (POSIX only; see WorkerProcesses.h).  Each
+	// worker returns the statistics of its blocks, which are merged in block order as
+	// usual, so the result is bit-identical to a single-process run.  Workers price their
+	// blocks serially:  runParallel and numThreads are then ignored.  No other threads may be
+	// running at the time, so parallel pricers must have been destroyed, and the shared pools
+	// of ThreadPool::shared(.) not yet started.
+	int numProcesses = 1;
+
+	// Progressive pricing:  with onProgress set, blocks are run in rounds of blocksPerCheck, as
+	// for targetStdError, and onProgress is called after each round with the running estimate
+	// (from the merged blocks, so the same whatever the number of threads).  The simulation
+	// stops early, with cancelled() set, if onProgress returns false or a stop is requested
+	// on stopToken (for instance from the thread that owns the std::stop_source, while the
+	// pricer runs on another).  The estimate is then that of the scenarios done.
+	std::function<bool(const ProgressUpdate& update)> onProgress;
+	std::stop_token stopToken;
+
+	// Memory kept for reprice(.).  S(T) depends on the variates of a path only through
+	// W(T), so with TERMINAL a block priced once is repriced from its cached W(T) alone,
+	// with no variates generated and no time steps taken.  Payoffs of S(T) and double-precision
+	// paths only; blocks priced in worker processes (numProcesses > 1) are not cached, and
+	// are regenerated.
+	VariateCache variateCache = VariateCache::NONE;
+
+	// SINGLE simulates the paths in float, with twice the SIMD width of double (PSEUDO_RANDOM
+	// sampling and payoffs of S(T) only, without variateCache).  Each S(T) is widened to
+	// double before its payoff, and the running sums and estimates are in double, so the
+	// only change is a relative error below 1e-5 in each S(T), far below the Monte Carlo error.
+	PathPrecision pathPrecision = PathPrecision::DOUBLE;
+
+	// Scratch memory (the buffers of each block, the statistics and tables of a run) comes
+	// from monotonic arenas owned by the pricer, one per worker thread (see Arena.h), which
+	// are reset between blocks and between runs and keep their memory.  Repricing therefore
+	// makes no calls into the global allocator once the arenas have grown, except in worker
+	// processes and for the setup of quasi-random sampling.  memoryResource, if set, is the
+	// upstream the arenas take their memory from; it must be thread-safe.  If it is a
+	// CountingResource (see Instrumentation.h), stats().allocations counts what they take.
+	std::pmr::memory_resource* memoryResource = nullptr;
 };
 
 class MCEuroOptPricer
 {
 public:
+	// Vanilla call or put:  the option type is dispatched once, to CallPayoff or PutPayoff.
 	MCEuroOptPricer(double strike, double spot, double riskFreeRate, double volatility,
 		double timeToExpiry, OptionType optionType, int numTimeSteps, int numScenarios,
 		bool runParallel, int initSeed, double quantity);
 
+	MCEuroOptPricer(double strike, double spot, double riskFreeRate, double volatility,
+		double timeToExpiry, OptionType optionType, int numTimeSteps, int numScenarios,
+		int initSeed, double quantity, const MCSettings& settings);
+
+	// Any payoff policy (see Payoffs.h), including user-defined function objects.  The
+	// loop over the scenarios of a block is instantiated for the policy, with the payoff
+	// inlined; only the call per block goes through a function pointer.
+	template<PayoffPolicy Payoff>
+	MCEuroOptPricer(const Payoff& payoff, double spot, double riskFreeRate, double volatility,
+		double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+		const MCSettings& settings = MCSettings());
+
+	// Path-dependent payoff policy (see PathPayoffs.h), observing each time step as the paths
+	// of a block are advanced together.  Needs PSEUDO_RANDOM sampling without
+	// terminalSampling; the Greeks are not available.
+	template<PathPayoffPolicy Payoff>
+	MCEuroOptPricer(const Payoff& payoff, double spot, double riskFreeRate, double volatility,
+		double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+		const MCSettings& settings = MCSettings());
+
+	// Prices from the paths of a scenario store (see ScenarioStore.h), with no simulation:  the
+	// spot, time grid and discount factor come from the store, and the payoffs read the prices
+	// straight from the mapped file.  Needs PSEUDO_RANDOM settings without antithetic,
+	// terminalSampling, computeGreeks, variateCache or single precision (that of the store is
+	// used), and reprice(.) is not available.  The store is used during construction only.
+	template<PayoffPolicy Payoff>
+	MCEuroOptPricer(const Payoff& payoff, const ScenarioStore& store, double quantity,
+		const MCSettings& settings = MCSettings());
+	template<PathPayoffPolicy Payoff>
+	MCEuroOptPricer(const Payoff& payoff, const ScenarioStore& store, double quantity,
+		const MCSettings& settings = MCSettings());
+
+	// Prices on the paths of an SdeEngine (see SdeEngine.h):  any model and discretization
+	// scheme, such as Heston with the QE scheme or CEV with Milstein, with the same blocks,
+	// threads and worker processes as GBM.  The spot, rate, time grid and discount factor
+	// come from the engine.  Needs PSEUDO_RANDOM settings without terminalSampling,
+	// computeGreeks, variateCache or single precision, which rely on the GBM dynamics, and
+	// reprice(.) is not available.  The control variate remains valid, as discounted S(T)
+	// has mean S(0) under each model (up to the discretization bias of the scheme).
+	template<PayoffPolicy Payoff, typename Model, typename Scheme>
+	MCEuroOptPricer(const Payoff& payoff, const SdeEngine<Model, Scheme>& engine, int numScenarios,
+		int initSeed, double quantity, const MCSettings& settings = MCSettings());
+
 	double operator()() const;
-	double time() const;		// Time required to run calcutions (for comparison using concurrency)
+	double time() const;		// Wall-clock time required to run calculations (for comparison using concurrency)
+	const PricerStats& stats() const;	// Timing per phase, paths/sec and allocations; see Instrumentation.h
+
+	// Standard error of the price:  from the sample variance of the scenarios for
+	// PSEUDO_RANDOM, from the spread of the replication estimates for SCRAMBLED_SOBOL,
+	// and NaN for SOBOL, whose points are not independent.
+	double stdError() const;
+	int scenariosUsed() const;	// Less than numScenarios if targetStdError was reached early, or if cancelled
+	bool cancelled() const;		// Stopped through MCSettings::onProgress or stopToken
+
+	// price -/+ z * stdError(), z the normal quantile for the two-sided level
+	// (e.g. 0.95); NaN bounds where stdError() is NaN.
+	ConfidenceInterval confidenceInterval(double level = 0.95) const;
+
+	// NaN values unless MCSettings::computeGreeks is set; standard errors as for stdError():
+	const MCGreeks& greeks() const;
+
+	// Bump-and-revalue with common random numbers:  prices again with new market inputs on
+	// the same scenarios (the same seed, so the same variates), and returns the new price.
+	// Differences between prices, as in finite-difference Greeks or scenario ladders, then
+	// have far less noise than those between independent runs.  How much of the first run
+	// is reused is set by MCSettings::variateCache.
+	double reprice(const MarketInputs& inputs);
+	MarketInputs marketInputs() const;
 
 private:
+	// Streaming statistics over a set of scenarios:  the control x (discounted S(T)) with
+	// the discounted payoff y, and the per-scenario estimators of the Greeks.
+	struct ScenarioStats_
+	{
+		RunningCovariance payoff;
+		RunningStats delta, gamma, vega, rho;
+
+		void merge(const ScenarioStats_& other);
+	};
+
+	// Read-only objects shared by every block of scenarios in one simulation:
+	struct Simulation_
+	{
+		Simulation_(const MCEuroOptPricer& pricer, std::pmr::memory_resource* resource);
+
+		EquityPriceGenerator epg;
+		CounterBasedNormals rng;
+		CounterBasedNormals antitheticRng;
+		std::unique_ptr<SobolSequence> sobol;		// Quasi-random sampling only
+		std::unique_ptr<BrownianBridge> bridge;		// Quasi-random sampling of whole paths only
+		std::vector<std::uint32_t> shifts;			// SCRAMBLED_SOBOL:  numReplications x dimension
+	};
+
+	// Adds the scenarios first, first + 1, ... with the given terminal prices to stats[scenario % numReplications]:
+	using PayoffEvaluator_ = std::function<void(const MCEuroOptPricer& pricer, int first,
+		std::span<const double> prices, std::span<const double> antitheticPrices, ScenarioStats_* stats)>;
+
+	// Path-dependent payoffs generate the paths of a block themselves, in place of priceBlock_(.):
+	using PathPayoffEvaluator_ = std::function<void(const MCEuroOptPricer& pricer, const Simulation_& sim,
+		int first, std::span<double> prices, std::span<double> antitheticPrices, ScenarioStats_* stats,
+		PhaseTimes& times)>;
+
+	template<PayoffPolicy Payoff>
+	void setPayoff_(const Payoff& payoff);
+	template<PathPayoffPolicy Payoff>
+	void setPayoff_(const Payoff& payoff);
+	void setVanillaPayoff_(double strike, OptionType porc);
+
+	template<PayoffPolicy Payoff>
+	void addScenarios_(const Payoff& payoff, int first, std::span<const double> prices,
+		std::span<const double> antitheticPrices, ScenarioStats_* stats) const;
+	template<PathPayoffPolicy Payoff>
+	void addPathScenarios_(const Payoff& payoff, const Simulation_& sim, int first, std::span<double> prices,
+		std::span<double> antitheticPrices, ScenarioStats_* stats, PhaseTimes& times) const;
+
+	// Terminal prices of scenarios first, first + 1, ... from an SdeEngine, in place of EquityPriceGenerator:
+	using SdePathGenerator_ = std::function<void(const CounterBasedNormals& rng, int first,
+		std::span<double> prices, std::pmr::memory_resource* workspace)>;
+
 	void calculate_();			// Start calculation of option price
+	void initFromStore_();		// Model inputs from store_, and checks the settings
+	void checkSdeSettings_() const;
 
 	// Private helper functions:
 	void computePrice_();
-	void generateSeeds_();
-	double payoff_(double terminalPrice);
+	void estimate_(const std::pmr::vector<ScenarioStats_>& repStats);	// Sets price_, stdError_ and greeks_
+	GreekEstimate estimateGreek_(const std::pmr::vector<ScenarioStats_>& repStats, RunningStats ScenarioStats_::* greek) const;
+	int numReplications_() const;
+
+	// Statistics of one block of scenarios, one entry per replication (stats[r], r = 0, ..., numReplications - 1):
+	void priceBlock_(const Simulation_& sim, int block, ScenarioStats_* stats, PhaseTimes& times) const;
+	Arena& blockArena_() const;		// Scratch memory of the block being priced on the calling thread
+	template<typename Real>		// Real, double or float, is the scalar type of the paths
+	void pseudoRandomPrices_(const Simulation_& sim, int first, std::span<double> prices,
+		std::span<double> antitheticPrices) const;
+	void quasiRandomPrices_(const Simulation_& sim, int first, std::span<double> prices,
+		std::span<double> antitheticPrices, std::pmr::memory_resource* workspace) const;
+
+	// Prices of scenarios first, ..., first + n - 1 at a time step of store_:  a view of the
+	// mapped file, or of buffer holding them widened to double for a single-precision store.
+	std::span<const double> storedPrices_(int step, int first, int n, std::pmr::vector<double>& buffer) const;
+	// As EquityPriceGenerator::terminalPrices(rng, first, prices, observer), on stored paths:
+	void replayStoredPaths_(int first, std::span<double> prices, const PathObserver& observer) const;
+
+	// S(T) from standardized W(T) / sqrt(T), and back, under the current market inputs:
+	void pricesFromVariates_(const double* variates, std::span<double> prices) const;
+	void variatesFromPrices_(std::span<const double> prices, double* variates) const;
+
+	// Delta, gamma, vega and rho estimators of one path, from S(T) and the payoff and its slope there:
+	void greekEstimators_(double terminalPrice, double payoff, double payoffSlope, double* greeks) const;
 
-	// Compare results:  non-parallel vs in-parallel with async and futures
-	void computePriceNoParallel_();
-	void computePriceAsync_();
+	// Compare results:  non-parallel vs in-parallel on a fixed-size thread pool.
+	// Both fill the statistics of blocks firstBlock, firstBlock + 1, ...; these are merged
+	// in block order, so the price does not depend on the number of threads.
+	void computePriceNoParallel_(const Simulation_& sim, int firstBlock, std::pmr::vector<ScenarioStats_>& blockStats,
+		std::pmr::vector<PhaseTimes>& blockTimes) const;
+	void computePriceParallel_(const Simulation_& sim, ThreadPool& pool, int firstBlock,
+		std::pmr::vector<ScenarioStats_>& blockStats, std::pmr::vector<PhaseTimes>& blockTimes) const;
+	void computePriceSharded_(const Simulation_& sim, int firstBlock, std::pmr::vector<ScenarioStats_>& blockStats,
+		std::pmr::vector<PhaseTimes>& blockTimes) const;
 
 	// Inputs to model:
-	double strike_;
+	PayoffEvaluator_ payoff_;
+	PathPayoffEvaluator_ pathPayoff_;		// Set for path-dependent payoffs only
+	SdePathGenerator_ sdePaths_;			// Set when pricing on an SdeEngine only
 	double spot_;
 	double riskFreeRate_;
 	double volatility_;
 	double timeToExpiry_;	// Time to expiration (as year fraction)
-	OptionType porc_;		// porc_: put or call
 	int numTimeSteps_;	
 	int numScenarios_;
-	bool runParallel_ = true;
-	int initSeed_ = 106;	// Initial seed setting
+	int initSeed_ = 106;	// Key of the counter-based random number streams
 	double quantity_ = 1.0;	// Number of contracts
+	MCSettings settings_;
+	const ScenarioStore* store_ = nullptr;		// Set when pricing from stored scenarios
 
 	// Computed values:
 	double discFactor_;
 	double price_;
+	double stdError_;
+	int scenariosUsed_;
+	bool cancelled_ = false;
+	MCGreeks greeks_;
 
-	// Vector storing generated seeds for the MC scenarios:
-	std::vector<int> seeds_;
+	// MCSettings::variateCache == TERMINAL:  the variates of each block, empty until it is
+	// first priced.  Each block writes only its own entry, from whichever thread prices it.
+	mutable std::vector<std::vector<double>> variateCache_;
+
+	// Thread pool and arenas, created by the first run and kept for reprice(.).  Defined in
+	// the .cpp file, hence the deleter:  the pricer is movable but not copyable.
+	struct Workspace_;
+	static void deleteWorkspace_(Workspace_* workspace);
+	std::unique_ptr<Workspace_, void (*)(Workspace_*)> workspace_{ nullptr, &deleteWorkspace_ };
 
 	// Runtime comparison using concurrency
-	double time_;
+	PricerStats stats_;
 };
 
+template<PayoffPolicy Payoff>
+MCEuroOptPricer::MCEuroOptPricer(const Payoff& payoff, double spot, double riskFreeRate, double volatility,
+	double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+	const MCSettings& settings) :spot_(spot), riskFreeRate_(riskFreeRate), volatility_(volatility),
+	timeToExpiry_(timeToExpiry), numTimeSteps_(numTimeSteps), numScenarios_(numScenarios),
+	initSeed_(initSeed), quantity_(quantity), settings_(settings)
+{
+	setPayoff_(payoff);
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+	calculate_();
+}
+
+template<PathPayoffPolicy Payoff>
+MCEuroOptPricer::MCEuroOptPricer(const Payoff& payoff, double spot, double riskFreeRate, double volatility,
+	double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+	const MCSettings& settings) :spot_(spot), riskFreeRate_(riskFreeRate), volatility_(volatility),
+	timeToExpiry_(timeToExpiry), numTimeSteps_(numTimeSteps), numScenarios_(numScenarios),
+	initSeed_(initSeed), quantity_(quantity), settings_(settings)
+{
+	setPayoff_(payoff);
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+	calculate_();
+}
+
+template<PayoffPolicy Payoff>
+MCEuroOptPricer::MCEuroOptPricer(const Payoff& payoff, const ScenarioStore& store, double quantity,
+	const MCSettings& settings) :quantity_(quantity), settings_(settings), store_(&store)
+{
+	initFromStore_();
+	setPayoff_(payoff);
+	calculate_();
+}
+
+template<PathPayoffPolicy Payoff>
+MCEuroOptPricer::MCEuroOptPricer(const Payoff& payoff, const ScenarioStore& store, double quantity,
+	const MCSettings& settings) :quantity_(quantity), settings_(settings), store_(&store)
+{
+	initFromStore_();
+	setPayoff_(payoff);
+	calculate_();
+}
+
+template<PayoffPolicy Payoff, typename Model, typename Scheme>
+MCEuroOptPricer::MCEuroOptPricer(const Payoff& payoff, const SdeEngine<Model, Scheme>& engine, int numScenarios,
+	int initSeed, double quantity, const MCSettings& settings) :spot_(engine.spot()),
+	riskFreeRate_(engine.riskFreeRate()), volatility_(0.0), timeToExpiry_(engine.timeToExpiry()),
+	numTimeSteps_(engine.numTimeSteps()), numScenarios_(numScenarios), initSeed_(initSeed),
+	quantity_(quantity), settings_(settings)
+{
+	checkSdeSettings_();
+	// The engine is copied into the generator, whose call per block runs its inlined loop:
+	sdePaths_ = [engine](const CounterBasedNormals& rng, int first, std::span<double> prices,
+		std::pmr::memory_resource* workspace)
+	{
+		engine.terminalPrices(rng, first, prices, workspace);
+	};
+	setPayoff_(payoff);
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+	calculate_();
+}
+
+template<PayoffPolicy Payoff>
+void MCEuroOptPricer::setPayoff_(const Payoff& payoff)
+{
+	if (settings_.computeGreeks && !PayoffWithSlope<Payoff>)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: computeGreeks needs a payoff with slope(.)");
+	}
+	payoff_ = [payoff](const MCEuroOptPricer& pricer, int first, std::span<const double> prices,
+		std::span<const double> antitheticPrices, ScenarioStats_* stats)
+	{
+		pricer.addScenarios_(payoff, first, prices, antitheticPrices, stats);
+	};
+}
+
+template<PayoffPolicy Payoff>
+void MCEuroOptPricer::addScenarios_(const Payoff& payoff, int first, std::span<const double> prices,
+	std::span<const double> antitheticPrices, ScenarioStats_* stats) const
+{
+	const int numReps = numReplications_();
+	const bool antithetic = settings_.antithetic;
+	const double weight = antithetic ? 0.5 * discFactor_ : discFactor_;
+
+	for (std::size_t k = 0; k < prices.size(); ++k)
+	{
+		// The control x = discFactor * S(T) has mean S(0) under the risk-neutral measure:
+		double price = prices[k];
+		double antitheticPrice = antithetic ? antitheticPrices[k] : 0.0;
+		double y = weight * (antithetic ? payoff(price) + payoff(antitheticPrice) : payoff(price));
+		double x = weight * (price + antitheticPrice);
+
+		ScenarioStats_& scenarioStats = stats[(first + static_cast<int>(k)) % numReps];
+		scenarioStats.payoff.add(x, y);
+
+		if constexpr (PayoffWithSlope<Payoff>)
+		{
+			if (settings_.computeGreeks)
+			{
+				double greeks[4], antitheticGreeks[4] = { 0.0, 0.0, 0.0, 0.0 };
+				greekEstimators_(price, payoff(price), payoff.slope(price), greeks);
+				if (antithetic)
+				{
+					greekEstimators_(antitheticPrice, payoff(antitheticPrice), payoff.slope(antitheticPrice),
+						antitheticGreeks);
+				}
+				double scale = antithetic ? 0.5 : 1.0;
+				scenarioStats.delta.add(scale * (greeks[0] + antitheticGreeks[0]));
+				scenarioStats.gamma.add(scale * (greeks[1] + antitheticGreeks[1]));
+				scenarioStats.vega.add(scale * (greeks[2] + antitheticGreeks[2]));
+				scenarioStats.rho.add(scale * (greeks[3] + antitheticGreeks[3]));
+			}
+		}
+	}
+}
+
+template<PathPayoffPolicy Payoff>
+void MCEuroOptPricer::setPayoff_(const Payoff& payoff)
+{
+	if (settings_.sampling != SamplingScheme::PSEUDO_RANDOM || settings_.terminalSampling)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: path-dependent payoffs need PSEUDO_RANDOM sampling of whole paths");
+	}
+	if (settings_.computeGreeks)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: computeGreeks is not available for path-dependent payoffs");
+	}
+	if (settings_.variateCache != VariateCache::NONE)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: variateCache is not available for path-dependent payoffs");
+	}
+	if (settings_.pathPrecision != PathPrecision::DOUBLE)
+	{
+		throw std::invalid_argument("MCEuroOptPricer: path-dependent payoffs need double-precision paths");
+	}
+	pathPayoff_ = [payoff](const MCEuroOptPricer& pricer, const Simulation_& sim, int first, std::span<double> prices,
+		std::span<double> antitheticPrices, ScenarioStats_* stats, PhaseTimes& times)
+	{
+		pricer.addPathScenarios_(payoff, sim, first, prices, antitheticPrices, stats, times);
+	};
+}
+
+template<PathPayoffPolicy Payoff>
+void MCEuroOptPricer::addPathScenarios_(const Payoff& payoff, const Simulation_& sim, int first,
+	std::span<double> prices, std::span<double> antitheticPrices, ScenarioStats_* stats, PhaseTimes& times) const
+{
+	using State = typename Payoff::State;
+	const int numReps = numReplications_();
+	const bool antithetic = settings_.antithetic;
+	const double weight = antithetic ? 0.5 * discFactor_ : discFactor_;
+
+	// One State per scenario of the block; the observers update them step by step:
+	Arena& arena = blockArena_();
+	std::pmr::vector<State> states(prices.size(), payoff.initialState(spot_), &arena);
+	std::pmr::vector<State> antitheticStates(antithetic ? prices.size() : 0, payoff.initialState(spot_), &arena);
+	{
+		ScopedTimer timer(times.pathGeneration);
+		auto observer = [&payoff, &states](const PathStep& step, const double* prev, const double* next, std::size_t n)
+		{
+			for (std::size_t k = 0; k < n; ++k)
+			{
+				payoff.observe(states[k], step, prev[k], next[k]);
+			}
+		};
+		if (store_)
+		{
+			replayStoredPaths_(first, prices, observer);
+		}
+		else
+		{
+			sim.epg.terminalPrices(sim.rng, first, prices, observer, &arena);
+		}
+		if (antithetic)
+		{
+			sim.epg.terminalPrices(sim.antitheticRng, first, antitheticPrices,
+				[&payoff, &antitheticStates](const PathStep& step, const double* prev, const double* next, std::size_t n)
+				{
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						payoff.observe(antitheticStates[k], step, prev[k], next[k]);
+					}
+				}, &arena);
+		}
+	}
+
+	ScopedTimer timer(times.payoffEvaluation);
+	for (std::size_t k = 0; k < prices.size(); ++k)
+	{
+		double price = prices[k];
+		double antitheticPrice = antithetic ? antitheticPrices[k] : 0.0;
+		double y = weight * (antithetic ? payoff(states[k], price) + payoff(antitheticStates[k], antitheticPrice)
+			: payoff(states[k], price));
+		double x = weight * (price + antitheticPrice);
+		stats[(first + static_cast<int>(k)) % numReps].payoff.add(x, y);
+	}
+}
+
 #endif
 
 /*
@@ -0,0 +1,132 @@
+#include "MCMultiAssetPricer.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+
+using std::vector;
+
+double MCMultiAssetPricer::operator()() const
+{
+	return price_;
+}
+
+double MCMultiAssetPricer::stdError() const
+{
+	return stdError_;
+}
+
+double MCMultiAssetPricer::time() const
+{
+	return stats_.wallTime;
+}
+
+const PricerStats& MCMultiAssetPricer::stats() const
+{
+	return stats_;
+}
+
+void MCMultiAssetPricer::calculate_()
+{
+	if (settings_.sampling != SamplingScheme::PSEUDO_RANDOM)
+	{
+		throw std::invalid_argument("MCMultiAssetPricer: only PSEUDO_RANDOM sampling is supported");
+	}
+	if (settings_.controlVariate || settings_.computeGreeks || settings_.targetStdError > 0.0)
+	{
+		throw std::invalid_argument("MCMultiAssetPricer: control variate, Greeks and target error are not supported");
+	}
+
+	stats_ = PricerStats();
+	RunTimer runTimer;
+
+	// With terminalSampling, one exact step to expiry:
+	std::optional<ScopedTimer> setupTimer(std::in_place, stats_.phases.setup);
+	MultiAssetPriceGenerator generator(spots_, volatilities_, correlation_,
+		settings_.terminalSampling ? 1 : numTimeSteps_, timeToExpiry_, riskFreeRate_);
+	CounterBasedNormals rng(initSeed_);
+	CounterBasedNormals antitheticRng(initSeed_, true);
+	discFactor_ = std::exp(-riskFreeRate_ * timeToExpiry_);
+
+	int numBlocks = (numScenarios_ + settings_.blockSize - 1) / settings_.blockSize;
+	vector<RunningStats> blockStats(numBlocks);
+	vector<PhaseTimes> blockTimes(numBlocks);
+	ThreadPool* pool = settings_.runParallel ? &ThreadPool::shared(settings_.numThreads) : nullptr;
+	setupTimer.reset();
+
+	auto priceBlock = [this, &generator, &rng, &antitheticRng, &blockStats, &blockTimes](int block)
+	{
+		priceBlock_(generator, rng, antitheticRng, block, blockStats[block], blockTimes[block]);
+	};
+	forEachTask(pool, numBlocks, priceBlock);
+
+	// Merge in block order, so the results do not depend on the number of threads:
+	std::optional<ScopedTimer> reductionTimer(std::in_place, stats_.phases.reduction);
+	RunningStats stats;
+	for (int block = 0; block < numBlocks; ++block)
+	{
+		stats.merge(blockStats[block]);
+		stats_.phases.merge(blockTimes[block]);
+	}
+	price_ = quantity_ * stats.mean();
+	stdError_ = std::abs(quantity_) * stats.stdError();
+	reductionTimer.reset();
+
+	stats_.numPaths = static_cast<long long>(numScenarios_) * (settings_.antithetic ? 2 : 1);
+	runTimer.stop(stats_);
+}
+
+void MCMultiAssetPricer::priceBlock_(const MultiAssetPriceGenerator& generator, const CounterBasedNormals& rng,
+	const CounterBasedNormals& antitheticRng, int block, RunningStats& stats, PhaseTimes& times) const
+{
+	int first = block * settings_.blockSize;
+	std::size_t n = std::min(first + settings_.blockSize, numScenarios_) - first;
+	std::size_t numAssets = spots_.size();
+
+	// Terminal prices of the block, asset x scenario:
+	vector<double> terminalPrices(numAssets * n), antitheticPrices(settings_.antithetic ? numAssets * n : 0);
+	{
+		ScopedTimer timer(times.pathGeneration);
+		generator.terminalPrices(rng, first, terminalPrices);
+		if (settings_.antithetic)
+		{
+			generator.terminalPrices(antitheticRng, first, antitheticPrices);
+		}
+	}
+
+	ScopedTimer timer(times.payoffEvaluation);
+	vector<double> payoffs(n), antitheticPayoffs(settings_.antithetic ? n : 0);
+	payoff_(terminalPrices, n, payoffs.data());
+	double scale = discFactor_;
+	if (settings_.antithetic)
+	{
+		payoff_(antitheticPrices, n, antitheticPayoffs.data());
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			payoffs[k] += antitheticPayoffs[k];
+		}
+		scale *= 0.5;
+	}
+	for (auto& payoff : payoffs)
+	{
+		payoff *= scale;
+	}
+	stats.addBlock(payoffs.data(), n);
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
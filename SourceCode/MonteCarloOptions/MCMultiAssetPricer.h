@@ -0,0 +1,87 @@
+#ifndef MC_MULTI_ASSET_PRICER_H
+#define MC_MULTI_ASSET_PRICER_H
+
+#include "MCEuroOptPricer.h"
+#include "MultiAssetPriceGenerator.h"
+#include "MultiAssetPayoffs.h"
+#include <vector>
+#include <span>
+#include <functional>
+
+// European options on several correlated assets (baskets, spreads), priced by the same
+// block engine as MCEuroOptPricer:  blocks of scenarios from MultiAssetPriceGenerator are
+// priced on the thread pool and their statistics merged in block order, so the price does
+// not depend on the number of threads.
+//
+// Of the MCSettings, runParallel, numThreads, blockSize, terminalSampling and antithetic
+// are used; only PSEUDO_RANDOM sampling is supported, and the control variate, Greeks
+// and the target error are not available.
+class MCMultiAssetPricer
+{
+public:
+	// Any multi-asset payoff policy (see MultiAssetPayoffs.h); correlation is numAssets x
+	// numAssets, row-major.
+	template<MultiAssetPayoffPolicy Payoff>
+	MCMultiAssetPricer(const Payoff& payoff, const std::vector<double>& spots,
+		const std::vector<double>& volatilities, const std::vector<double>& correlation, double riskFreeRate,
+		double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+		const MCSettings& settings = MCSettings());
+
+	double operator()() const;
+	double stdError() const;
+	double time() const;		// Wall-clock seconds for the simulation
+	const PricerStats& stats() const;
+
+private:
+	void calculate_();
+	void priceBlock_(const MultiAssetPriceGenerator& generator, const CounterBasedNormals& rng,
+		const CounterBasedNormals& antitheticRng, int block, RunningStats& stats, PhaseTimes& times) const;
+
+	MultiAssetEvaluator payoff_;		// Of the terminal prices
+	std::vector<double> spots_;
+	std::vector<double> volatilities_;
+	std::vector<double> correlation_;
+	double riskFreeRate_;
+	double timeToExpiry_;
+	int numTimeSteps_;
+	int numScenarios_;
+	int initSeed_;
+	double quantity_;
+	MCSettings settings_;
+
+	// Computed values:
+	double discFactor_;
+	double price_;
+	double stdError_;
+	PricerStats stats_;
+};
+
+template<MultiAssetPayoffPolicy Payoff>
+MCMultiAssetPricer::MCMultiAssetPricer(const Payoff& payoff, const std::vector<double>& spots,
+	const std::vector<double>& volatilities, const std::vector<double>& correlation, double riskFreeRate,
+	double timeToExpiry, int numTimeSteps, int numScenarios, int initSeed, double quantity,
+	const MCSettings& settings) :spots_(spots), volatilities_(volatilities), correlation_(correlation),
+	riskFreeRate_(riskFreeRate), timeToExpiry_(timeToExpiry), numTimeSteps_(numTimeSteps),
+	numScenarios_(numScenarios), initSeed_(initSeed), quantity_(quantity), settings_(settings)
+{
+	payoff_ = makeMultiAssetEvaluator(payoff, spots.size());
+	calculate_();
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
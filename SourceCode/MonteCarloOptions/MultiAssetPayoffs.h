@@ -0,0 +1,95 @@
+#ifndef MULTI_ASSET_PAYOFFS_H
+#define MULTI_ASSET_PAYOFFS_H
+
+#include "Payoffs.h"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+// Multi-asset payoff policies:  function objects mapping the prices at expiry of all assets
+// of one scenario (prices[a] for asset a) to the payoff of one contract.  As for the
+// single-asset policies in Payoffs.h, the pricer takes them as template arguments.
+template<typename Payoff>
+concept MultiAssetPayoffPolicy = std::copy_constructible<Payoff> &&
+	requires(const Payoff& payoff, std::span<const double> prices)
+{
+	{ payoff(prices) } -> std::convertible_to<double>;
+};
+
+// Writes the undiscounted payoffs of n scenarios, given their prices asset x scenario (asset
+// a of scenario k at prices[a * n + k]), as the pricers evaluate a whole block at once:
+using MultiAssetEvaluator = std::function<void(std::span<const double> prices, std::size_t n, double* payoffs)>;
+
+// Evaluator of a multi-asset payoff policy on numAssets assets.  The prices of one scenario
+// are gathered into a small buffer, reused for the whole block.
+template<MultiAssetPayoffPolicy Payoff>
+MultiAssetEvaluator makeMultiAssetEvaluator(const Payoff& payoff, std::size_t numAssets)
+{
+	return [payoff, numAssets](std::span<const double> prices, std::size_t n, double* payoffs)
+	{
+		std::vector<double> scenarioPrices(numAssets);
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			for (std::size_t a = 0; a < numAssets; ++a)
+			{
+				scenarioPrices[a] = prices[a * n + k];
+			}
+			payoffs[k] = payoff(std::span<const double>(scenarioPrices));
+		}
+	};
+}
+
+// Call or put on the weighted sum of the asset prices:
+struct BasketPayoff
+{
+	std::vector<double> weights;	// One per asset; weights beyond the last asset are ignored
+	double strike;
+	OptionType optionType = OptionType::CALL;
+
+	double operator()(std::span<const double> prices) const
+	{
+		double basket = 0.0;
+		for (std::size_t a = 0; a < std::min(weights.size(), prices.size()); ++a)
+		{
+			basket += weights[a] * prices[a];
+		}
+		return (optionType == OptionType::CALL) ? std::max(basket - strike, 0.0) : std::max(strike - basket, 0.0);
+	}
+};
+
+// Call or put on the spread S_first - S_second between two of the assets; with strike 0,
+// the option to exchange the second asset for the first:
+struct SpreadPayoff
+{
+	double strike;
+	OptionType optionType = OptionType::CALL;
+	int first = 0;
+	int second = 1;
+
+	double operator()(std::span<const double> prices) const
+	{
+		double spread = prices[first] - prices[second];
+		return (optionType == OptionType::CALL) ? std::max(spread - strike, 0.0) : std::max(strike - spread, 0.0);
+	}
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
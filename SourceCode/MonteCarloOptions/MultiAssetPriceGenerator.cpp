@@ -0,0 +1,226 @@
+#include "MultiAssetPriceGenerator.h"
+#include "GbmKernel.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+using std::vector;
+
+MultiAssetPriceGenerator::MultiAssetPriceGenerator(const vector<double>& initPrices, const vector<double>& volatilities,
+	const vector<double>& correlation, unsigned numTimeSteps, double timeToExpiry, double drift) :
+	initPrices_(initPrices), numAssets_(static_cast<int>(initPrices.size())), numTimeSteps_(numTimeSteps)
+{
+	if (numAssets_ == 0 || volatilities.size() != initPrices.size())
+	{
+		throw std::invalid_argument("MultiAssetPriceGenerator: need one volatility per asset, and at least one asset");
+	}
+	if (correlation.size() != static_cast<std::size_t>(numAssets_) * numAssets_)
+	{
+		throw std::invalid_argument("MultiAssetPriceGenerator: correlation must be numAssets x numAssets");
+	}
+	if (numTimeSteps_ < 1)
+	{
+		throw std::invalid_argument("MultiAssetPriceGenerator: at least one time step is required");
+	}
+	factorize_(correlation);
+
+	double dt = timeToExpiry / numTimeSteps_;
+	stepDrifts_.resize(numAssets_);
+	stepDiffusions_.resize(numAssets_);
+	for (int a = 0; a < numAssets_; ++a)
+	{
+		stepDrifts_[a] = (drift - ((volatilities[a] * volatilities[a]) / 2.0)) * dt;
+		stepDiffusions_[a] = volatilities[a] * std::sqrt(dt);
+	}
+}
+
+int MultiAssetPriceGenerator::numAssets() const
+{
+	return numAssets_;
+}
+
+int MultiAssetPriceGenerator::numTimeSteps() const
+{
+	return numTimeSteps_;
+}
+
+MultiAssetPriceGenerator::Workspace_::Workspace_(int numAssets) :normals(numAssets * batchSize_),
+	nextNormals(numAssets * batchSize_), correlated(numAssets * batchSize_), scenarioNormals(2 * numAssets) {}
+
+void MultiAssetPriceGenerator::factorize_(const vector<double>& correlation)
+{
+	const int n = numAssets_;
+	for (int i = 0; i < n; ++i)
+	{
+		if (correlation[i * n + i] != 1.0)
+		{
+			throw std::invalid_argument("MultiAssetPriceGenerator: correlation matrix must have unit diagonal");
+		}
+		for (int j = 0; j < i; ++j)
+		{
+			if (correlation[i * n + j] != correlation[j * n + i])
+			{
+				throw std::invalid_argument("MultiAssetPriceGenerator: correlation matrix must be symmetric");
+			}
+			if (std::abs(correlation[i * n + j]) > 1.0)
+			{
+				throw std::invalid_argument("MultiAssetPriceGenerator: correlations must be in [-1, 1]");
+			}
+		}
+	}
+
+	// Cholesky-Banachiewicz, row by row:
+	cholesky_.assign(static_cast<std::size_t>(n) * n, 0.0);
+	for (int i = 0; i < n; ++i)
+	{
+		for (int j = 0; j <= i; ++j)
+		{
+			double sum = correlation[i * n + j];
+			for (int k = 0; k < j; ++k)
+			{
+				sum -= cholesky_[i * n + k] * cholesky_[j * n + k];
+			}
+			if (i == j)
+			{
+				if (sum <= 0.0)
+				{
+					throw std::invalid_argument("MultiAssetPriceGenerator: correlation matrix must be positive definite");
+				}
+				cholesky_[i * n + i] = std::sqrt(sum);
+			}
+			else
+			{
+				cholesky_[i * n + j] = sum / cholesky_[j * n + j];
+			}
+		}
+	}
+}
+
+void MultiAssetPriceGenerator::correlatedNormals_(const CounterBasedNormals& rng, int first, std::size_t n,
+	int step, Workspace_& ws) const
+{
+	const std::size_t numAssets = numAssets_;
+
+	// Independent variates, transposed to asset x scenario:
+	if (step % 2 == 1)
+	{
+		std::swap(ws.normals, ws.nextNormals);
+	}
+	else
+	{
+		bool twoSteps = step + 1 < numTimeSteps_;
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			rng(first + k, static_cast<std::uint64_t>(step) * numAssets, ws.scenarioNormals.data(),
+				twoSteps ? 2 * numAssets : numAssets);
+			for (std::size_t a = 0; a < numAssets; ++a)
+			{
+				ws.normals[a * n + k] = ws.scenarioNormals[a];
+			}
+			if (twoSteps)
+			{
+				for (std::size_t a = 0; a < numAssets; ++a)
+				{
+					ws.nextNormals[a * n + k] = ws.scenarioNormals[numAssets + a];
+				}
+			}
+		}
+	}
+
+	// Row a of L z for every scenario at once:  correlated_a = sum over b <= a of L(a, b) * z_b
+	for (std::size_t a = 0; a < numAssets; ++a)
+	{
+		const double* row = cholesky_.data() + a * numAssets;
+		double* out = ws.correlated.data() + a * n;
+		const double* z = ws.normals.data();
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			out[k] = row[0] * z[k];
+		}
+		for (std::size_t b = 1; b <= a; ++b)
+		{
+			double weight = row[b];
+			const double* zb = z + b * n;
+			for (std::size_t k = 0; k < n; ++k)
+			{
+				out[k] += weight * zb[k];
+			}
+		}
+	}
+}
+
+void MultiAssetPriceGenerator::operator()(const CounterBasedNormals& rng, int firstScenario,
+	MultiAssetScenarios& paths) const
+{
+	if (paths.numAssets() != numAssets_ || paths.numPrices() != numTimeSteps_ + 1)
+	{
+		throw std::invalid_argument("MultiAssetPriceGenerator: paths must hold numAssets assets and numTimeSteps + 1 prices");
+	}
+
+	const std::size_t numScens = paths.numScenarios();
+	Workspace_ ws(numAssets_);
+	for (std::size_t batch = 0; batch < numScens; batch += batchSize_)
+	{
+		std::size_t n = std::min(batchSize_, numScens - batch);
+		for (int a = 0; a < numAssets_; ++a)
+		{
+			std::fill_n(paths.prices(a, 0).data() + batch, n, initPrices_[a]);
+		}
+		for (int i = 1; i <= numTimeSteps_; ++i)
+		{
+			correlatedNormals_(rng, firstScenario + static_cast<int>(batch), n, i - 1, ws);
+			for (int a = 0; a < numAssets_; ++a)
+			{
+				gbmStep(paths.prices(a, i - 1).data() + batch, ws.correlated.data() + a * n,
+					paths.prices(a, i).data() + batch, n, stepDrifts_[a], stepDiffusions_[a]);
+			}
+		}
+	}
+}
+
+void MultiAssetPriceGenerator::terminalPrices(const CounterBasedNormals& rng, int firstScenario,
+	std::span<double> prices) const
+{
+	if (prices.size() % numAssets_ != 0)
+	{
+		throw std::invalid_argument("MultiAssetPriceGenerator: prices must hold numAssets x numScenarios values");
+	}
+
+	// Each batch is advanced through all time steps while its prices are in cache:
+	const std::size_t numScens = prices.size() / numAssets_;
+	Workspace_ ws(numAssets_);
+	for (std::size_t batch = 0; batch < numScens; batch += batchSize_)
+	{
+		std::size_t n = std::min(batchSize_, numScens - batch);
+		for (int a = 0; a < numAssets_; ++a)
+		{
+			std::fill_n(prices.data() + a * numScens + batch, n, initPrices_[a]);
+		}
+		for (int i = 0; i < numTimeSteps_; ++i)
+		{
+			correlatedNormals_(rng, firstScenario + static_cast<int>(batch), n, i, ws);
+			for (int a = 0; a < numAssets_; ++a)
+			{
+				double* assetPrices = prices.data() + a * numScens + batch;
+				gbmStep(assetPrices, ws.correlated.data() + a * n, assetPrices, n, stepDrifts_[a], stepDiffusions_[a]);
+			}
+		}
+	}
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
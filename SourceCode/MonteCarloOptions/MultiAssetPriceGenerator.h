@@ -0,0 +1,86 @@
+#ifndef MULTI_ASSET_PRICE_GENERATOR_H
+#define MULTI_ASSET_PRICE_GENERATOR_H
+
+#include "ScenarioMatrix.h"
+#include "Philox.h"
+#include <vector>
+#include <span>
+#include <cstddef>
+
+// Correlated geometric Brownian motions for numAssets assets, with a common drift (the
+// risk-free rate) and constant volatilities and correlations, on a uniform time grid.
+//
+// The correlation matrix is factorized once, C = L L^T (Cholesky), in the constructor.
+// Scenario k uses the independent variates z(k, i * numAssets + a) of a CounterBasedNormals
+// stream at time step i, and asset a is driven by the a-th element of L z.  Scenarios are
+// processed in batches:  for each time step, the variates of a batch are laid out asset by
+// asset, and L is applied to all of them at once as a sequence of row updates over
+// contiguous scenarios, which vectorize.  All workspace is sized once per call, so no
+// memory is allocated per time step, however many assets there are.  With one asset, the
+// prices equal those of EquityPriceGenerator for the same stream.
+class MultiAssetPriceGenerator
+{
+public:
+	// correlation:  numAssets x numAssets, row-major, symmetric positive definite with unit diagonal
+	MultiAssetPriceGenerator(const std::vector<double>& initPrices, const std::vector<double>& volatilities,
+		const std::vector<double>& correlation, unsigned numTimeSteps, double timeToExpiry, double drift);
+
+	int numAssets() const;
+	int numTimeSteps() const;
+
+	// Whole paths of scenarios firstScenario, ..., firstScenario + paths.numScenarios() - 1;
+	// paths must hold numAssets assets and numTimeSteps + 1 prices.
+	void operator()(const CounterBasedNormals& rng, int firstScenario, MultiAssetScenarios& paths) const;
+
+	// Prices at timeToExpiry only, asset x scenario:  prices[a * n + k] for asset a and
+	// scenario firstScenario + k, where n = prices.size() / numAssets.  Paths are not stored.
+	void terminalPrices(const CounterBasedNormals& rng, int firstScenario, std::span<double> prices) const;
+
+private:
+	// Scenarios generated together; a batch of prices and variates of 50 assets stays in cache:
+	static constexpr std::size_t batchSize_ = 256;
+
+	// Workspace for one batch, numAssets x batchSize_ each:
+	struct Workspace_
+	{
+		explicit Workspace_(int numAssets);
+
+		std::vector<double> normals;
+		std::vector<double> nextNormals;		// Drawn with those of the previous (even) step
+		std::vector<double> correlated;
+		std::vector<double> scenarioNormals;	// The variates of one scenario over two steps
+	};
+
+	void factorize_(const std::vector<double>& correlation);
+
+	// Correlated variates of step `step` for scenarios first, ..., first + n - 1, into
+	// ws.correlated (asset a at ws.correlated[a * n + k]).  Steps must come in order:  the
+	// variates of steps 2j and 2j + 1 are drawn together, so that every Box-Muller pair is
+	// used even for an odd number of assets.
+	void correlatedNormals_(const CounterBasedNormals& rng, int first, std::size_t n, int step, Workspace_& ws) const;
+
+	std::vector<double> initPrices_;
+	std::vector<double> cholesky_;			// Lower triangular factor L, row-major numAssets x numAssets
+	std::vector<double> stepDrifts_;		// (drift - vol_a^2/2) * dt, per asset
+	std::vector<double> stepDiffusions_;	// vol_a * sqrt(dt), per asset
+	int numAssets_;
+	int numTimeSteps_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,155 @@
+#include "NormalGenerator.h"
+#include "InverseNormal.h"
+#include <array>
+#include <cmath>
+
+namespace
+{
+	// Ziggurat of 128 layers of equal area v under exp(-x^2/2) (Doornik, "An Improved
+	// Ziggurat Method to Generate Normal Random Samples", 2005).  Layer i spans
+	// [0, x[i]] x [f(x[i]), f(x[i+1])]; layer 0 is the base strip with the tail beyond r.
+	constexpr int numLayers = 128;
+	constexpr double zigR = 3.442619855899;
+	constexpr double zigV = 9.91256303526217e-3;
+
+	struct ZigguratTables
+	{
+		std::array<double, numLayers + 1> x;
+		std::array<double, numLayers> ratio;		// x[i+1] / x[i]:  |u| below it is inside the layer's rectangle
+
+		ZigguratTables()
+		{
+			double f = std::exp(-0.5 * zigR * zigR);
+			x[0] = zigV / f;
+			x[1] = zigR;
+			x[numLayers] = 0.0;
+			for (int i = 2; i < numLayers; ++i)
+			{
+				x[i] = std::sqrt(-2.0 * std::log(zigV / x[i - 1] + f));
+				f = std::exp(-0.5 * x[i] * x[i]);
+			}
+			for (int i = 0; i < numLayers; ++i)
+			{
+				ratio[i] = x[i + 1] / x[i];
+			}
+		}
+	};
+
+	const ZigguratTables& zigguratTables()
+	{
+		static const ZigguratTables tables;
+		return tables;
+	}
+}
+
+NormalGenerator::NormalGenerator(std::uint64_t seed, NormalMethod method) :engine_(seed), method_(method)
+{
+	zigguratTables();		// Built once, before any thread uses them
+}
+
+NormalMethod NormalGenerator::method() const
+{
+	return method_;
+}
+
+double NormalGenerator::operator()()
+{
+	switch (method_)
+	{
+	case NormalMethod::ZIGGURAT:
+		return ziggurat_();
+	case NormalMethod::INVERSE_CDF:
+		return inverseNormalCdf(uniform_());
+	default:
+		return polar_(engine_);
+	}
+}
+
+void NormalGenerator::operator()(double* out, std::size_t n)
+{
+	switch (method_)
+	{
+	case NormalMethod::ZIGGURAT:
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			out[i] = ziggurat_();
+		}
+		break;
+	case NormalMethod::INVERSE_CDF:
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			out[i] = uniform_();
+		}
+		inverseNormalCdf(out, out, n);
+		break;
+	default:
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			out[i] = polar_(engine_);
+		}
+	}
+}
+
+void NormalGenerator::operator()(std::span<double> out)
+{
+	(*this)(out.data(), out.size());
+}
+
+double NormalGenerator::uniform_()
+{
+	// Top 53 bits, offset by half a unit so that neither 0 nor 1 can occur:
+	return (static_cast<double>(engine_() >> 11) + 0.5) * 0x1.0p-53;
+}
+
+double NormalGenerator::ziggurat_()
+{
+	const ZigguratTables& tables = zigguratTables();
+	for (;;)
+	{
+		// One draw gives both the layer (low 7 bits) and u in (-1, 1) (top 53 bits):
+		std::uint64_t bits = engine_();
+		int i = static_cast<int>(bits & (numLayers - 1));
+		double u = 2.0 * ((static_cast<double>(bits >> 11) + 0.5) * 0x1.0p-53) - 1.0;
+
+		if (std::abs(u) < tables.ratio[i])
+		{
+			return u * tables.x[i];
+		}
+		if (i == 0)
+		{
+			// Tail beyond r (Marsaglia's method):
+			double x, y;
+			do
+			{
+				x = std::log(uniform_()) / zigR;
+				y = std::log(uniform_());
+			} while (-2.0 * y < x * x);
+			return (u < 0.0) ? x - zigR : zigR - x;
+		}
+
+		// Wedge between the rectangle and the curve:
+		double x = u * tables.x[i];
+		double f0 = std::exp(-0.5 * (tables.x[i] * tables.x[i] - x * x));
+		double f1 = std::exp(-0.5 * (tables.x[i + 1] * tables.x[i + 1] - x * x));
+		if (f1 + uniform_() * (f0 - f1) < 1.0)
+		{
+			return x;
+		}
+	}
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
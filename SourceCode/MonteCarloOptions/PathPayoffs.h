@@ -0,0 +1,187 @@
+#ifndef PATH_PAYOFFS_H
+#define PATH_PAYOFFS_H
+
+#include "Payoffs.h"
+#include "EquityPriceGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <utility>
+
+// Path-dependent payoff policies:  instead of a stored path, a policy sees each time step
+// as it is generated and folds it into a small per-path State (a running sum, a maximum, a
+// survival probability), so the memory needed per path does not grow with the number of
+// time steps.  A policy provides
+//
+//	State initialState(double spot) const;
+//	void observe(State& state, const PathStep& step, double prev, double next) const;
+//	double operator()(const State& state, double terminalPrice) const;
+//
+// where observe(.) is called for steps 1, ..., numTimeSteps in order, with the prices at
+// the start (prev) and at the end (next) of the step.
+template<typename Payoff>
+concept PathPayoffPolicy = std::copy_constructible<Payoff> && std::copyable<typename Payoff::State> &&
+	requires(const Payoff& payoff, typename Payoff::State& state, const PathStep& step, double s)
+{
+	{ payoff.initialState(s) } -> std::same_as<typename Payoff::State>;
+	payoff.observe(state, step, s, s);
+	{ payoff(std::as_const(state), s) } -> std::convertible_to<double>;
+};
+
+// Arithmetic average price option, on the average of S(t_1), ..., S(t_n):
+struct AsianPayoff
+{
+	double strike;
+	OptionType optionType = OptionType::CALL;
+
+	struct State
+	{
+		double sum;
+		int count;
+	};
+
+	State initialState(double) const { return State{ 0.0, 0 }; }
+
+	void observe(State& state, const PathStep&, double, double next) const
+	{
+		state.sum += next;
+		++state.count;
+	}
+
+	double operator()(const State& state, double) const
+	{
+		double average = state.sum / state.count;
+		return (optionType == OptionType::CALL) ? std::max(average - strike, 0.0) : std::max(strike - average, 0.0);
+	}
+};
+
+enum class BarrierType
+{
+	UP_AND_OUT,
+	DOWN_AND_OUT,
+	UP_AND_IN,
+	DOWN_AND_IN
+};
+
+// Vanilla call or put that is knocked out (or in) when the price reaches the barrier.
+//
+// With continuousMonitoring, the barrier is watched between the time steps as well:  given
+// S(t_(i-1)) and S(t_i) on the same side of the barrier B, the log price crossed it during
+// the step with the Brownian bridge probability
+//
+//	p = exp(-2 ln(B / S(t_(i-1))) ln(B / S(t_i)) / (sigma^2 dt)),
+//
+// and the state carries the product of the survival probabilities 1 - p instead of a hit
+// flag.  This removes the bias of monitoring only at t_1, ..., t_n without extra steps.
+// Otherwise the barrier is checked at the time steps only.
+struct BarrierPayoff
+{
+	double strike;
+	double barrier;
+	BarrierType barrierType = BarrierType::UP_AND_OUT;
+	OptionType optionType = OptionType::CALL;
+	bool continuousMonitoring = true;
+
+	struct State
+	{
+		double survival;	// Probability that the barrier has not been reached
+	};
+
+	State initialState(double spot) const { return State{ crossed_(spot) ? 0.0 : 1.0 }; }
+
+	void observe(State& state, const PathStep& step, double prev, double next) const
+	{
+		if (crossed_(next))
+		{
+			state.survival = 0.0;
+		}
+		else if (continuousMonitoring && state.survival > 0.0)
+		{
+			double variance = step.volatility * step.volatility * step.dt;
+			state.survival *= 1.0 - std::exp(-2.0 * std::log(barrier / prev) * std::log(barrier / next) / variance);
+		}
+	}
+
+	double operator()(const State& state, double terminalPrice) const
+	{
+		double vanilla = (optionType == OptionType::CALL) ? std::max(terminalPrice - strike, 0.0)
+			: std::max(strike - terminalPrice, 0.0);
+		bool knockOut = (barrierType == BarrierType::UP_AND_OUT) || (barrierType == BarrierType::DOWN_AND_OUT);
+		return vanilla * (knockOut ? state.survival : 1.0 - state.survival);
+	}
+
+private:
+	bool crossed_(double s) const
+	{
+		bool up = (barrierType == BarrierType::UP_AND_OUT) || (barrierType == BarrierType::UP_AND_IN);
+		return up ? (s >= barrier) : (s <= barrier);
+	}
+};
+
+// Lookback options on the maximum M and minimum m of S(0), S(t_1), ..., S(t_n) (discrete
+// monitoring; no continuity correction is applied).
+//
+// Fixed strike:  max(M - K, 0) for a call, max(K - m, 0) for a put.
+struct FixedStrikeLookbackPayoff
+{
+	double strike;
+	OptionType optionType = OptionType::CALL;
+
+	struct State
+	{
+		double max;
+		double min;
+	};
+
+	State initialState(double spot) const { return State{ spot, spot }; }
+
+	void observe(State& state, const PathStep&, double, double next) const
+	{
+		state.max = std::max(state.max, next);
+		state.min = std::min(state.min, next);
+	}
+
+	double operator()(const State& state, double) const
+	{
+		return (optionType == OptionType::CALL) ? std::max(state.max - strike, 0.0) : std::max(strike - state.min, 0.0);
+	}
+};
+
+// Floating strike:  S(T) - m for a call, M - S(T) for a put.
+struct FloatingStrikeLookbackPayoff
+{
+	OptionType optionType = OptionType::CALL;
+
+	using State = FixedStrikeLookbackPayoff::State;
+
+	State initialState(double spot) const { return State{ spot, spot }; }
+
+	void observe(State& state, const PathStep&, double, double next) const
+	{
+		state.max = std::max(state.max, next);
+		state.min = std::min(state.min, next);
+	}
+
+	double operator()(const State& state, double terminalPrice) const
+	{
+		return (optionType == OptionType::CALL) ? terminalPrice - state.min : state.max - terminalPrice;
+	}
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
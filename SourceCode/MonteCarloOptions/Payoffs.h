@@ -0,0 +1,91 @@
+#ifndef PAYOFFS_H
+#define PAYOFFS_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+enum class OptionType
+{
+	CALL,
+	PUT
+};
+
+// Payoff policies:  function objects mapping the price of the underlying at expiry to the
+// payoff of one contract.  The pricers take them as template arguments, so a payoff is
+// inlined into the loop over scenarios instead of being chosen by a switch per scenario,
+// and a new payoff needs no change to the pricers.  Any copyable type with
+// double operator()(double) const can be used.
+//
+// A policy may also provide slope(s), the derivative of the payoff in s (where it exists),
+// as needed by the pathwise Greek estimators.  Discontinuous payoffs such as the digital
+// must not provide it:  their pathwise derivative is zero almost everywhere, and the
+// pathwise delta would be wrong.
+template<typename Payoff>
+concept PayoffPolicy = std::copy_constructible<Payoff> && requires(const Payoff& payoff, double s)
+{
+	{ payoff(s) } -> std::convertible_to<double>;
+};
+
+template<typename Payoff>
+concept PayoffWithSlope = PayoffPolicy<Payoff> && requires(const Payoff& payoff, double s)
+{
+	{ payoff.slope(s) } -> std::convertible_to<double>;
+};
+
+struct CallPayoff
+{
+	double strike;
+
+	double operator()(double s) const { return std::max(s - strike, 0.0); }
+	double slope(double s) const { return s > strike ? 1.0 : 0.0; }
+};
+
+struct PutPayoff
+{
+	double strike;
+
+	double operator()(double s) const { return std::max(strike - s, 0.0); }
+	double slope(double s) const { return s < strike ? -1.0 : 0.0; }
+};
+
+// Pays cash if the option expires in the money, and nothing otherwise:
+struct DigitalPayoff
+{
+	double strike;
+	OptionType optionType = OptionType::CALL;
+	double cash = 1.0;
+
+	double operator()(double s) const
+	{
+		bool inTheMoney = (optionType == OptionType::CALL) ? (s > strike) : (s < strike);
+		return inTheMoney ? cash : 0.0;
+	}
+};
+
+// A call plus a put at the same strike:
+struct StraddlePayoff
+{
+	double strike;
+
+	double operator()(double s) const { return std::abs(s - strike); }
+	double slope(double s) const { return s > strike ? 1.0 : (s < strike ? -1.0 : 0.0); }
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
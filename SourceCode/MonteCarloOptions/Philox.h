@@ -0,0 +1,134 @@
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+// Philox4x32-10 counter-based random number generator (Salmon, Moraes, Dror and Shaw,
+// "Parallel Random Numbers: As Easy as 1, 2, 3", SC11).  The output is a pure function
+// of a 128-bit counter and a 64-bit key, so there is no state to seed or to advance:
+// skipping to any position in any stream is O(1).
+class Philox4x32
+{
+public:
+	using Counter = std::array<std::uint32_t, 4>;
+	using Key = std::array<std::uint32_t, 2>;
+
+	static Counter generate(Counter ctr, Key key)
+	{
+		for (int round = 0; round < 10; ++round)
+		{
+			if (round > 0)
+			{
+				key[0] += 0x9E3779B9u;		// Weyl sequence constants
+				key[1] += 0xBB67AE85u;
+			}
+			std::uint64_t prod0 = std::uint64_t(0xD2511F53u) * ctr[0];
+			std::uint64_t prod1 = std::uint64_t(0xCD9E8D57u) * ctr[2];
+			ctr = { static_cast<std::uint32_t>(prod1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(prod1),
+				static_cast<std::uint32_t>(prod0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(prod0) };
+		}
+		return ctr;
+	}
+};
+
+// Standard normal variates z(scenario, step) for a given seed.  Each value depends only
+// on (seed, scenario, step), so any thread can generate any scenario's variates without
+// constructing or seeding an engine, and a simulation gives the same numbers however
+// its scenarios are divided among threads.  One Philox call gives 128 random bits,
+// which become the pair z(scenario, 2j), z(scenario, 2j + 1) via Box-Muller.
+// The antithetic stream returns -z(scenario, step) for the same seed.
+class CounterBasedNormals
+{
+public:
+	explicit CounterBasedNormals(std::int64_t seed, bool antithetic = false) :
+		key_{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(static_cast<std::uint64_t>(seed) >> 32) },
+		sign_(antithetic ? -1.0 : 1.0) {}
+
+	double operator()(std::uint64_t scenario, std::uint64_t step) const
+	{
+		double pair[2];
+		normalPair(scenario, step / 2, pair);
+		return pair[step % 2];
+	}
+
+	// out[j] = z(scenario, firstStep + j), j = 0, ..., n - 1
+	void operator()(std::uint64_t scenario, std::uint64_t firstStep, double* out, std::size_t n) const
+	{
+		std::uint64_t step = firstStep;
+		std::size_t j = 0;
+		if (step % 2 == 1 && n > 0)
+		{
+			out[j++] = (*this)(scenario, step++);
+		}
+		for (; j + 2 <= n; j += 2, step += 2)
+		{
+			normalPair(scenario, step / 2, out + j);
+		}
+		if (j < n)
+		{
+			out[j] = (*this)(scenario, step);
+		}
+	}
+
+	// out[0] = z(scenario, 2 * pairIndex), out[1] = z(scenario, 2 * pairIndex + 1)
+	void normalPair(std::uint64_t scenario, std::uint64_t pairIndex, double* out) const
+	{
+		Philox4x32::Counter bits = bits_(scenario, pairIndex);
+
+		// Two uniforms strictly inside (0, 1), from the top 53 bits of each 64-bit half:
+		double u1 = (static_cast<double>(((std::uint64_t(bits[1]) << 32) | bits[0]) >> 11) + 0.5) * 0x1.0p-53;
+		double u2 = (static_cast<double>(((std::uint64_t(bits[3]) << 32) | bits[2]) >> 11) + 0.5) * 0x1.0p-53;
+
+		const double twoPi = 6.283185307179586477;
+		double r = sign_ * std::sqrt(-2.0 * std::log(u1));
+		out[0] = r * std::cos(twoPi * u2);
+		out[1] = r * std::sin(twoPi * u2);
+	}
+
+	// Single-precision version, for float paths:  Box-Muller in float on the top 24 bits of
+	// the same uniforms, so each variate is close to its double counterpart (the tails are
+	// cut at about 5.9 instead of 8.6 standard deviations).
+	void normalPair(std::uint64_t scenario, std::uint64_t pairIndex, float* out) const
+	{
+		Philox4x32::Counter bits = bits_(scenario, pairIndex);
+		float u1 = (static_cast<float>(bits[1] >> 8) + 0.5f) * 0x1.0p-24f;
+		float u2 = (static_cast<float>(bits[3] >> 8) + 0.5f) * 0x1.0p-24f;
+
+		const float twoPi = 6.28318531f;
+		float r = static_cast<float>(sign_) * std::sqrt(-2.0f * std::log(u1));
+		out[0] = r * std::cos(twoPi * u2);
+		out[1] = r * std::sin(twoPi * u2);
+	}
+
+private:
+	Philox4x32::Counter bits_(std::uint64_t scenario, std::uint64_t pairIndex) const
+	{
+		Philox4x32::Counter ctr{ static_cast<std::uint32_t>(pairIndex), static_cast<std::uint32_t>(pairIndex >> 32),
+			static_cast<std::uint32_t>(scenario), static_cast<std::uint32_t>(scenario >> 32) };
+		return Philox4x32::generate(ctr, key_);
+	}
+
+	Philox4x32::Key key_;
+	double sign_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
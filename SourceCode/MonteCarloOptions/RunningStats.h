@@ -0,0 +1,141 @@
+#ifndef RUNNING_STATS_H
+#define RUNNING_STATS_H
+
+#include <cmath>
+#include <limits>
+#include <cstddef>
+
+// Streaming mean and variance by Welford's method:  each sample updates the count, the
+// mean and M2 = sum of squared deviations from the mean, so memory is O(1) in the number
+// of samples and there is no cancellation as with sums of squares.  Partial results from
+// separate threads or blocks are combined with merge(.) (Chan, Golub and LeVeque, 1979);
+// merging in a fixed order gives the same result however the samples were divided.
+class RunningStats
+{
+public:
+	void add(double x)
+	{
+		count_ += 1.0;
+		double delta = x - mean_;
+		mean_ += delta / count_;
+		m2_ += delta * (x - mean_);
+	}
+
+	// Adds n samples at once:  their mean and M2 are found in two tight passes over the
+	// array, with no division per sample, and then merged as a partial result.
+	void addBlock(const double* x, std::size_t n)
+	{
+		if (n == 0)
+		{
+			return;
+		}
+		double sum = 0.0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			sum += x[i];
+		}
+		RunningStats block;
+		block.count_ = static_cast<double>(n);
+		block.mean_ = sum / block.count_;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			double delta = x[i] - block.mean_;
+			block.m2_ += delta * delta;
+		}
+		merge(block);
+	}
+
+	void merge(const RunningStats& other)
+	{
+		if (other.count_ == 0.0)
+		{
+			return;
+		}
+		double n = count_ + other.count_;
+		double delta = other.mean_ - mean_;
+		mean_ += delta * other.count_ / n;
+		m2_ += other.m2_ + delta * delta * count_ * other.count_ / n;
+		count_ = n;
+	}
+
+	double count() const { return count_; }
+	double mean() const { return count_ > 0.0 ? mean_ : std::numeric_limits<double>::quiet_NaN(); }
+
+	// Sample variance (with the n - 1 denominator), and the standard error of the mean:
+	double variance() const { return count_ > 1.0 ? m2_ / (count_ - 1.0) : std::numeric_limits<double>::quiet_NaN(); }
+	double stdError() const { return std::sqrt(variance() / count_); }
+
+private:
+	double count_ = 0.0;
+	double mean_ = 0.0;
+	double m2_ = 0.0;
+};
+
+// The same for a pair of samples (x, y), also keeping the co-moment
+// C = sum of (x - mean x)(y - mean y), as needed to fit a control variate.
+class RunningCovariance
+{
+public:
+	void add(double x, double y)
+	{
+		double n = count_ + 1.0;
+		double deltaX = x - meanX_;
+		double deltaY = y - meanY_;
+		meanX_ += deltaX / n;
+		meanY_ += deltaY / n;
+		m2X_ += deltaX * (x - meanX_);
+		m2Y_ += deltaY * (y - meanY_);
+		cXY_ += deltaX * (y - meanY_);
+		count_ = n;
+	}
+
+	void merge(const RunningCovariance& other)
+	{
+		if (other.count_ == 0.0)
+		{
+			return;
+		}
+		double n = count_ + other.count_;
+		double deltaX = other.meanX_ - meanX_;
+		double deltaY = other.meanY_ - meanY_;
+		double weight = count_ * other.count_ / n;
+		meanX_ += deltaX * other.count_ / n;
+		meanY_ += deltaY * other.count_ / n;
+		m2X_ += other.m2X_ + deltaX * deltaX * weight;
+		m2Y_ += other.m2Y_ + deltaY * deltaY * weight;
+		cXY_ += other.cXY_ + deltaX * deltaY * weight;
+		count_ = n;
+	}
+
+	double count() const { return count_; }
+	double meanX() const { return count_ > 0.0 ? meanX_ : std::numeric_limits<double>::quiet_NaN(); }
+	double meanY() const { return count_ > 0.0 ? meanY_ : std::numeric_limits<double>::quiet_NaN(); }
+
+	// Sample moments, with the n - 1 denominator:
+	double varianceX() const { return count_ > 1.0 ? m2X_ / (count_ - 1.0) : std::numeric_limits<double>::quiet_NaN(); }
+	double varianceY() const { return count_ > 1.0 ? m2Y_ / (count_ - 1.0) : std::numeric_limits<double>::quiet_NaN(); }
+	double covariance() const { return count_ > 1.0 ? cXY_ / (count_ - 1.0) : std::numeric_limits<double>::quiet_NaN(); }
+
+private:
+	double count_ = 0.0;
+	double meanX_ = 0.0, meanY_ = 0.0;
+	double m2X_ = 0.0, m2Y_ = 0.0, cXY_ = 0.0;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
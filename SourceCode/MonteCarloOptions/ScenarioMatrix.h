@@ -0,0 +1,123 @@
+#ifndef SCENARIO_MATRIX_H
+#define SCENARIO_MATRIX_H
+
+#include <vector>
+#include <span>
+#include <cstddef>
+
+// Storage order of a set of simulated paths:
+//	SCENARIO_MAJOR:	row-major numScenarios x numPrices; each path is contiguous
+//	STEP_MAJOR:		numPrices x numScenarios; all prices at one time step are contiguous
+enum class PathLayout
+{
+	SCENARIO_MAJOR,
+	STEP_MAJOR
+};
+
+// Owns one contiguous block of memory holding numScenarios paths of numPrices
+// prices each (numPrices = numTimeSteps + 1, as returned by EquityPriceGenerator).
+class ScenarioMatrix
+{
+public:
+	ScenarioMatrix(int numScenarios, int numPrices, PathLayout layout = PathLayout::SCENARIO_MAJOR) :
+		data_(static_cast<std::size_t>(numScenarios) * numPrices), numScenarios_(numScenarios),
+		numPrices_(numPrices), layout_(layout) {}
+
+	double operator()(int scenario, int step) const
+	{
+		return data_[index_(scenario, step)];
+	}
+
+	double& operator()(int scenario, int step)
+	{
+		return data_[index_(scenario, step)];
+	}
+
+	int numScenarios() const { return numScenarios_; }
+	int numPrices() const { return numPrices_; }
+	PathLayout layout() const { return layout_; }
+
+	std::span<double> data() { return data_; }
+	std::span<const double> data() const { return data_; }
+
+private:
+	std::size_t index_(int scenario, int step) const
+	{
+		return layout_ == PathLayout::SCENARIO_MAJOR ?
+			static_cast<std::size_t>(scenario) * numPrices_ + step :
+			static_cast<std::size_t>(step) * numScenarios_ + scenario;
+	}
+
+	std::vector<double> data_;
+	int numScenarios_;
+	int numPrices_;
+	PathLayout layout_;
+};
+
+// Paths of numAssets correlated assets in one contiguous block, asset x step x scenario:  for
+// each asset and time step, the prices of all scenarios are contiguous (the STEP_MAJOR
+// layout of ScenarioMatrix, one asset after another).
+class MultiAssetScenarios
+{
+public:
+	MultiAssetScenarios(int numAssets, int numPrices, int numScenarios) :
+		data_(static_cast<std::size_t>(numAssets) * numPrices * numScenarios), numAssets_(numAssets),
+		numPrices_(numPrices), numScenarios_(numScenarios) {}
+
+	double operator()(int asset, int step, int scenario) const
+	{
+		return data_[index_(asset, step) + scenario];
+	}
+
+	double& operator()(int asset, int step, int scenario)
+	{
+		return data_[index_(asset, step) + scenario];
+	}
+
+	// Prices of all scenarios of one asset at one time step:
+	std::span<double> prices(int asset, int step)
+	{
+		return std::span<double>(data_).subspan(index_(asset, step), numScenarios_);
+	}
+
+	std::span<const double> prices(int asset, int step) const
+	{
+		return std::span<const double>(data_).subspan(index_(asset, step), numScenarios_);
+	}
+
+	int numAssets() const { return numAssets_; }
+	int numPrices() const { return numPrices_; }
+	int numScenarios() const { return numScenarios_; }
+
+	std::span<double> data() { return data_; }
+	std::span<const double> data() const { return data_; }
+
+private:
+	std::size_t index_(int asset, int step) const
+	{
+		return (static_cast<std::size_t>(asset) * numPrices_ + step) * numScenarios_;
+	}
+
+	std::vector<double> data_;
+	int numAssets_;
+	int numPrices_;
+	int numScenarios_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
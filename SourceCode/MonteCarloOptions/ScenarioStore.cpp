@@ -0,0 +1,227 @@
+#include "ScenarioStore.h"
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The tables follow the header, so it must keep them aligned:
+static_assert(sizeof(ScenarioStoreHeader) % alignof(double) == 0, "ScenarioStoreHeader breaks table alignment");
+static_assert(std::is_trivially_copyable_v<ScenarioStoreHeader>, "ScenarioStoreHeader must be trivially copyable");
+
+namespace
+{
+	// Maps the whole file read-only; nullptr if it cannot be opened or mapped.  The file
+	// handles are closed at once:  the mapping stays valid until it is unmapped.
+	const std::byte* mapFile_(const std::string& fileName, std::size_t& size)
+	{
+#ifdef _WIN32
+		HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+		LARGE_INTEGER fileSize;
+		HANDLE mapping = nullptr;
+		void* view = nullptr;
+		if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+		{
+			size = static_cast<std::size_t>(fileSize.QuadPart);
+			mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		}
+		if (mapping)
+		{
+			view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+		}
+		CloseHandle(file);
+		return static_cast<const std::byte*>(view);
+#else
+		int fd = open(fileName.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+		struct stat status;
+		void* view = MAP_FAILED;
+		if (fstat(fd, &status) == 0 && status.st_size > 0)
+		{
+			size = static_cast<std::size_t>(status.st_size);
+			view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+		}
+		close(fd);
+		return (view == MAP_FAILED) ? nullptr : static_cast<const std::byte*>(view);
+#endif
+	}
+
+	void unmapFile_(const std::byte* data, std::size_t size)
+	{
+#ifdef _WIN32
+		(void)size;
+		UnmapViewOfFile(data);
+#else
+		munmap(const_cast<std::byte*>(data), size);
+#endif
+	}
+
+	// nullptr for a valid store, or else what is wrong with it:
+	const char* checkStore_(const std::byte* data, std::size_t size)
+	{
+		if (size < sizeof(ScenarioStoreHeader))
+		{
+			return "file too short for a header";
+		}
+		ScenarioStoreHeader header;
+		std::memcpy(&header, data, sizeof(header));
+		if (std::memcmp(header.magic, ScenarioStore::magic, sizeof(header.magic)) != 0)
+		{
+			return "not a scenario store";
+		}
+		if (header.version != ScenarioStore::version)
+		{
+			return "unsupported version";
+		}
+		if (header.scalarSize != sizeof(double) && header.scalarSize != sizeof(float))
+		{
+			return "invalid scalar size";
+		}
+		if (header.numScenarios <= 0 || header.numScenarios > INT32_MAX || header.numTimeSteps <= 0 ||
+			header.numTimeSteps > INT32_MAX - 1)
+		{
+			return "invalid dimensions";
+		}
+		if (header.dataOffset != ScenarioStore::dataOffset(static_cast<int>(header.numTimeSteps)))
+		{
+			return "invalid data offset";
+		}
+		if (size < header.dataOffset)
+		{
+			return "file truncated";
+		}
+		// The data size, (numTimeSteps + 1) x numScenarios x scalarSize, can exceed 2^64 in a
+		// corrupt header, so the number of scenarios that fit in the file is compared instead:
+		std::uint64_t scenariosInFile = (size - header.dataOffset) / header.scalarSize /
+			static_cast<std::uint64_t>(header.numTimeSteps + 1);
+		if (static_cast<std::uint64_t>(header.numScenarios) > scenariosInFile)
+		{
+			return "file truncated";
+		}
+		return nullptr;
+	}
+}
+
+std::uint64_t ScenarioStore::dataOffset(int numTimeSteps)
+{
+	std::uint64_t tableBytes = (3 * static_cast<std::uint64_t>(numTimeSteps) + 1) * sizeof(double);
+	std::uint64_t end = sizeof(ScenarioStoreHeader) + tableBytes;
+	return (end + pageSize - 1) / pageSize * pageSize;
+}
+
+ScenarioStore::ScenarioStore(const std::string& fileName)
+{
+	data_ = mapFile_(fileName, size_);
+	if (!data_)
+	{
+		throw std::runtime_error("ScenarioStore: cannot map " + fileName);
+	}
+	if (const char* problem = checkStore_(data_, size_))
+	{
+		unmapFile_(data_, size_);
+		throw std::runtime_error("ScenarioStore: " + fileName + ":  " + problem);
+	}
+}
+
+ScenarioStore::ScenarioStore(ScenarioStore&& other) noexcept :data_(other.data_), size_(other.size_)
+{
+	other.data_ = nullptr;
+	other.size_ = 0;
+}
+
+ScenarioStore::~ScenarioStore()
+{
+	if (data_)
+	{
+		unmapFile_(data_, size_);
+	}
+}
+
+const ScenarioStoreHeader& ScenarioStore::header() const
+{
+	// The mapping is page-aligned, so the header is suitably aligned:
+	return *reinterpret_cast<const ScenarioStoreHeader*>(data_);
+}
+
+int ScenarioStore::numScenarios() const
+{
+	return static_cast<int>(header().numScenarios);
+}
+
+int ScenarioStore::numTimeSteps() const
+{
+	return static_cast<int>(header().numTimeSteps);
+}
+
+PathPrecision ScenarioStore::precision() const
+{
+	return header().scalarSize == sizeof(float) ? PathPrecision::SINGLE : PathPrecision::DOUBLE;
+}
+
+double ScenarioStore::initPrice() const
+{
+	return header().initPrice;
+}
+
+std::span<const double> ScenarioStore::times() const
+{
+	const double* tables = reinterpret_cast<const double*>(data_ + sizeof(ScenarioStoreHeader));
+	return { tables, static_cast<std::size_t>(numTimeSteps()) + 1 };
+}
+
+std::span<const double> ScenarioStore::stepDrifts() const
+{
+	return { times().data() + numTimeSteps() + 1, static_cast<std::size_t>(numTimeSteps()) };
+}
+
+std::span<const double> ScenarioStore::stepDiffusions() const
+{
+	return { stepDrifts().data() + numTimeSteps(), static_cast<std::size_t>(numTimeSteps()) };
+}
+
+double ScenarioStore::discountFactor() const
+{
+	// Each step drift is the integral of r - sigma^2/2, and each diffusion the square root
+	// of the integral of sigma^2:
+	double rateIntegral = 0.0;
+	for (int i = 0; i < numTimeSteps(); ++i)
+	{
+		rateIntegral += stepDrifts()[i] + 0.5 * stepDiffusions()[i] * stepDiffusions()[i];
+	}
+	return std::exp(-rateIntegral);
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,103 @@
+#ifndef SCENARIO_STORE_H
+#define SCENARIO_STORE_H
+
+#include "EquityPriceGenerator.h"
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <stdexcept>
+
+// Fixed-size start of a scenario store file.  The whole file, in the byte order of the
+// machine that wrote it, is:
+//	ScenarioStoreHeader
+//	t_0 = 0, t_1, ..., t_n, then the n step drifts and the n step diffusions (doubles;
+//	see EquityPriceGenerator), which define the model the paths were simulated from
+//	padding up to dataOffset, a multiple of the page size
+//	the paths, step-major:  n + 1 rows of numScenarios prices (double or float), so that
+//	the prices of all scenarios at one time step are contiguous
+struct ScenarioStoreHeader
+{
+	char magic[8];					// "MCSCEN01"
+	std::uint32_t version;
+	std::uint32_t scalarSize;		// 8 (double) or 4 (float)
+	std::int64_t numScenarios;
+	std::int64_t numTimeSteps;		// n
+	double initPrice;
+	std::int64_t seed;				// Of the CounterBasedNormals streams
+	char generator[32];				// Random number generator, for the record
+	std::uint64_t dataOffset;		// Start of the paths, in bytes from the start of the file
+};
+
+// Read-only view of a scenario store, mapped into memory (mmap, or MapViewOfFile on Windows).
+// Nothing is read up front:  pages are loaded as the prices are used, and jobs mapping the
+// same file share one copy of it in the page cache.  Throws std::runtime_error if the file
+// cannot be mapped or is not a valid store.
+class ScenarioStore
+{
+public:
+	static constexpr char magic[9] = "MCSCEN01";
+	static constexpr std::uint32_t version = 1;
+	static constexpr std::uint64_t pageSize = 4096;
+
+	// Byte offset of the paths in a store with numTimeSteps time steps:
+	static std::uint64_t dataOffset(int numTimeSteps);
+
+	explicit ScenarioStore(const std::string& fileName);
+	ScenarioStore(ScenarioStore&& other) noexcept;
+	ScenarioStore(const ScenarioStore&) = delete;
+	ScenarioStore& operator=(const ScenarioStore&) = delete;
+	~ScenarioStore();
+
+	const ScenarioStoreHeader& header() const;
+	int numScenarios() const;
+	int numTimeSteps() const;
+	PathPrecision precision() const;
+	double initPrice() const;
+	std::span<const double> times() const;				// t_0 = 0, ..., t_n
+	std::span<const double> stepDrifts() const;
+	std::span<const double> stepDiffusions() const;
+	double discountFactor() const;		// exp(-integral of r over [0, t_n]), from the step tables
+
+	// Prices of all scenarios at time step 0, ..., numTimeSteps, straight from the mapping.
+	// Real must match the store:  double for DOUBLE, float for SINGLE.
+	template<typename Real>
+	std::span<const Real> prices(int step) const;
+
+private:
+	const std::byte* data_ = nullptr;
+	std::size_t size_ = 0;
+};
+
+template<typename Real>
+std::span<const Real> ScenarioStore::prices(int step) const
+{
+	if (header().scalarSize != sizeof(Real))
+	{
+		throw std::invalid_argument("ScenarioStore: scalar type does not match the store");
+	}
+	if (step < 0 || step > numTimeSteps())
+	{
+		throw std::invalid_argument("ScenarioStore: time step out of range");
+	}
+	const Real* rows = reinterpret_cast<const Real*>(data_ + header().dataOffset);
+	return { rows + static_cast<std::size_t>(step) * numScenarios(), static_cast<std::size_t>(numScenarios()) };
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,294 @@
+#ifndef SDE_ENGINE_H
+#define SDE_ENGINE_H
+
+#include "SdeModels.h"
+#include "Philox.h"
+#include "GbmKernel.h"
+#include <vector>
+#include <memory_resource>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Paths of a block of scenarios, advanced together one time step at a time:  prices[k] and,
+// for two-factor models, variances[k], k = 0, ..., size - 1.
+struct SdePaths
+{
+	double* prices;
+	double* variances;		// nullptr for one-factor models
+	std::size_t size;
+};
+
+// Discretization schemes:  stateless types whose static step(model, t, dt, paths, normals)
+// advances every path of a block from t to t + dt, given numFactors rows of size normal
+// variates (normals[f * size + k] drives factor f of path k).  Each overload is a loop
+// over the paths with the model's coefficients inlined and no branches or calls through
+// pointers, which the compiler can vectorize.  A scheme offers only the models it has an
+// overload for, so an unsupported pair does not compile.
+template<typename Scheme, typename Model>
+concept SdeSchemeFor = requires(const Model& model, double t, double dt, const SdePaths& paths, const double* normals)
+{
+	Scheme::step(model, t, dt, paths, normals);
+};
+
+// Euler-Maruyama:  weak order 1, strong order 1/2.  Prices of one-factor models are floored
+// at zero.  Heston is stepped in log-price, with full truncation of the variance (Lord,
+// Koekkoek and van Dijk):  max(v, 0) in the drift and diffusion, so v may go negative
+// but the paths stay defined.
+struct EulerScheme
+{
+	template<ScalarSdeModel Model>
+	static void step(const Model& model, double t, double dt, const SdePaths& paths, const double* normals)
+	{
+		const double sqrtDt = std::sqrt(dt);
+		double* prices = paths.prices;
+		for (std::size_t k = 0; k < paths.size; ++k)
+		{
+			double s = prices[k];
+			double next = s + model.drift(t, s) * dt + model.diffusion(t, s) * sqrtDt * normals[k];
+			prices[k] = std::max(next, 0.0);
+		}
+	}
+
+	static void step(const HestonModel& model, double, double dt, const SdePaths& paths, const double* normals)
+	{
+		const double sqrtDt = std::sqrt(dt);
+		const double rhoBar = std::sqrt(1.0 - model.correlation * model.correlation);
+		const double* varianceNormals = normals;
+		const double* otherNormals = normals + paths.size;
+		for (std::size_t k = 0; k < paths.size; ++k)
+		{
+			double v = std::max(paths.variances[k], 0.0);
+			double sqrtV = std::sqrt(v);
+			double priceNormal = model.correlation * varianceNormals[k] + rhoBar * otherNormals[k];
+			paths.prices[k] *= std::exp((model.riskFreeRate - 0.5 * v) * dt + sqrtV * sqrtDt * priceNormal);
+			paths.variances[k] += model.meanReversion * (model.longRunVariance - v) * dt
+				+ model.volOfVol * sqrtV * sqrtDt * varianceNormals[k];
+		}
+	}
+};
+
+// Milstein:  Euler with the correction (1/2) sigma sigma' (dW^2 - dt), which raises the
+// strong order to 1.  One-factor models only.
+struct MilsteinScheme
+{
+	template<ScalarSdeModel Model>
+	static void step(const Model& model, double t, double dt, const SdePaths& paths, const double* normals)
+	{
+		const double sqrtDt = std::sqrt(dt);
+		double* prices = paths.prices;
+		for (std::size_t k = 0; k < paths.size; ++k)
+		{
+			double s = prices[k];
+			double z = normals[k];
+			double sigma = model.diffusion(t, s);
+			double next = s + model.drift(t, s) * dt + sigma * sqrtDt * z
+				+ 0.5 * sigma * model.diffusionSlope(t, s) * dt * (z * z - 1.0);
+			prices[k] = std::max(next, 0.0);
+		}
+	}
+};
+
+// Exact GBM step, S -> S exp((r - sigma^2/2) dt + sigma sqrt(dt) z), with the vectorized
+// kernel of GbmKernel.h:  no discretization error, so the paths match those of
+// EquityPriceGenerator with the same variates.  GbmModel only.
+struct ExactGbmScheme
+{
+	static void step(const GbmModel& model, double, double dt, const SdePaths& paths, const double* normals)
+	{
+		gbmStep(paths.prices, normals, paths.prices, paths.size,
+			(model.riskFreeRate - 0.5 * model.volatility * model.volatility) * dt, model.volatility * std::sqrt(dt));
+	}
+};
+
+// Andersen's quadratic-exponential scheme for Heston ("Efficient Simulation of the Heston
+// Stochastic Volatility Model", 2008).  v(t + dt) is drawn from a distribution matched to
+// the first two moments of the exact, non-central chi-squared one:  a(b + z)^2 while
+// psi = s^2 / m^2 <= 1.5, and otherwise zero with probability p and exponential beyond.
+// Both branches are computed and one selected, so the loop has no branches.  v stays
+// non-negative, and the bias is far smaller than with Euler at the same step.  log S is
+// then stepped with the central (gamma_1 = gamma_2 = 1/2) discretization of the integrated
+// variance; the martingale correction is not applied, so E[S(T)] e^(-rT) differs from
+// S(0) by a bias that vanishes with dt.
+struct QuadraticExponentialScheme
+{
+	static void step(const HestonModel& model, double, double dt, const SdePaths& paths, const double* normals)
+	{
+		const double kappa = model.meanReversion;
+		const double theta = model.longRunVariance;
+		const double xi = model.volOfVol;
+		const double rho = model.correlation;
+		const double decay = std::exp(-kappa * dt);
+		const double varianceFromV = xi * xi * decay * (1.0 - decay) / kappa;
+		const double varianceConstant = theta * xi * xi * (1.0 - decay) * (1.0 - decay) / (2.0 * kappa);
+		const double k0 = (model.riskFreeRate - rho * kappa * theta / xi) * dt;
+		const double k1 = 0.5 * dt * (kappa * rho / xi - 0.5) - rho / xi;
+		const double k2 = 0.5 * dt * (kappa * rho / xi - 0.5) + rho / xi;
+		const double k3 = 0.5 * dt * (1.0 - rho * rho);
+		const double* varianceNormals = normals;
+		const double* priceNormals = normals + paths.size;
+
+		for (std::size_t k = 0; k < paths.size; ++k)
+		{
+			double v = paths.variances[k];
+			double z = varianceNormals[k];
+			double m = theta + (v - theta) * decay;
+			double psi = (v * varianceFromV + varianceConstant) / (m * m);
+
+			double twoOverPsi = 2.0 / psi;
+			double b2 = twoOverPsi - 1.0 + std::sqrt(twoOverPsi) * std::sqrt(std::max(twoOverPsi - 1.0, 0.0));
+			double b = std::sqrt(std::max(b2, 0.0));
+			double quadratic = m / (1.0 + b2) * (b + z) * (b + z);
+
+			double p = (psi - 1.0) / (psi + 1.0);
+			double tail = 0.5 * std::erfc(z * 0.70710678118654752);		// 1 - U, with U = N(z)
+			double exponential = (tail < 1.0 - p) ? std::log((1.0 - p) / tail) * m / (1.0 - p) : 0.0;
+
+			double next = (psi <= 1.5) ? quadratic : exponential;
+			paths.prices[k] *= std::exp(k0 + k1 * v + k2 * next + std::sqrt(k3 * (v + next)) * priceNormals[k]);
+			paths.variances[k] = next;
+		}
+	}
+};
+
+// Simulates the prices of any model of SdeModels.h with any scheme that supports it, on the
+// uniform grid t_i = i T / numTimeSteps.  The pair is fixed at compile time, so each
+// instantiation steps its paths with its own fully inlined loop; there is no per-step or
+// per-path dispatch.  The variates are counter-based, as in EquityPriceGenerator:  step i
+// of scenario k takes rng(k, i * numFactors + f) for factor f, so a one-factor model sees
+// the same variates as EquityPriceGenerator::terminalPrices(rng, ...), and any block of
+// scenarios can be simulated on any thread with the same result.
+//
+// Read-only after construction, and cheap to copy.
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+class SdeEngine
+{
+public:
+	SdeEngine(const Model& model, double spot, int numTimeSteps, double timeToExpiry);
+
+	// Prices at timeToExpiry of scenarios firstScenario, ..., firstScenario + prices.size() - 1.
+	// The paths are not stored; the buffers of variates (and variances) are allocated from
+	// workspace, for instance a per-thread Arena.
+	void terminalPrices(const CounterBasedNormals& rng, int firstScenario, std::span<double> prices,
+		std::pmr::memory_resource* workspace = std::pmr::get_default_resource()) const;
+
+	const Model& model() const;
+	double spot() const;
+	double riskFreeRate() const;
+	double timeToExpiry() const;
+	int numTimeSteps() const;
+
+private:
+	Model model_;
+	double spot_;
+	int numTimeSteps_;
+	double timeToExpiry_;
+	double dt_;
+};
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+SdeEngine<Model, Scheme>::SdeEngine(const Model& model, double spot, int numTimeSteps, double timeToExpiry) :
+	model_(model), spot_(spot), numTimeSteps_(numTimeSteps), timeToExpiry_(timeToExpiry)
+{
+	if (numTimeSteps <= 0 || !(timeToExpiry > 0.0) || !(spot > 0.0))
+	{
+		throw std::invalid_argument("SdeEngine: needs a positive spot, time to expiry and number of time steps");
+	}
+	dt_ = timeToExpiry_ / numTimeSteps_;
+}
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+void SdeEngine<Model, Scheme>::terminalPrices(const CounterBasedNormals& rng, int firstScenario,
+	std::span<double> prices, std::pmr::memory_resource* workspace) const
+{
+	constexpr int numFactors = Model::numFactors;
+	const std::size_t numScens = prices.size();
+
+	// Each call to the generator yields pairs of variates, so the variates of two time
+	// steps are drawn at once:  row j = s * numFactors + f of norms drives factor f at step s.
+	std::pmr::vector<double> norms(2 * numFactors * numScens, workspace);
+	std::pmr::vector<double> variances(numFactors > 1 ? numScens : 0, workspace);
+	SdePaths paths{ prices.data(), variances.data(), numScens };
+
+	std::fill(prices.begin(), prices.end(), spot_);
+	if constexpr (numFactors > 1)
+	{
+		std::fill(variances.begin(), variances.end(), model_.initialVariance);
+	}
+	for (int i = 0; i < numTimeSteps_; i += 2)
+	{
+		const int numSteps = std::min(2, numTimeSteps_ - i);
+		for (std::size_t k = 0; k < numScens; ++k)
+		{
+			double z[2 * numFactors];
+			rng(firstScenario + k, static_cast<std::uint64_t>(i) * numFactors, z, numSteps * numFactors);
+			for (int j = 0; j < numSteps * numFactors; ++j)
+			{
+				norms[j * numScens + k] = z[j];
+			}
+		}
+		for (int s = 0; s < numSteps; ++s)
+		{
+			Scheme::step(model_, (i + s) * dt_, dt_, paths, norms.data() + s * numFactors * numScens);
+		}
+	}
+}
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+const Model& SdeEngine<Model, Scheme>::model() const
+{
+	return model_;
+}
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+double SdeEngine<Model, Scheme>::spot() const
+{
+	return spot_;
+}
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+double SdeEngine<Model, Scheme>::riskFreeRate() const
+{
+	return model_.riskFreeRate;
+}
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+double SdeEngine<Model, Scheme>::timeToExpiry() const
+{
+	return timeToExpiry_;
+}
+
+template<typename Model, typename Scheme>
+	requires SdeSchemeFor<Scheme, Model>
+int SdeEngine<Model, Scheme>::numTimeSteps() const
+{
+	return numTimeSteps_;
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,110 @@
+#ifndef SDE_MODELS_H
+#define SDE_MODELS_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+// Models of the price of the underlying under the risk-neutral measure, as simulated by
+// SdeEngine (see SdeEngine.h).  A model is a plain struct of parameters with inline
+// coefficient functions, so that the stepping loop of each model/scheme pair is
+// instantiated with them inlined.
+//
+// One-factor models, dS = mu(t, S) dt + sigma(t, S) dW, provide the drift mu(t, S), the
+// diffusion sigma(t, S) and its slope d sigma / dS (for the Milstein scheme).  Any copyable
+// type with these and a member riskFreeRate (for discounting) can be used.
+template<typename Model>
+concept ScalarSdeModel = std::copy_constructible<Model> && requires(const Model& model, double t, double s)
+{
+	{ model.riskFreeRate } -> std::convertible_to<double>;
+	{ model.drift(t, s) } -> std::convertible_to<double>;
+	{ model.diffusion(t, s) } -> std::convertible_to<double>;
+	{ model.diffusionSlope(t, s) } -> std::convertible_to<double>;
+};
+
+// dS = r S dt + sigma S dW:
+struct GbmModel
+{
+	static constexpr int numFactors = 1;
+
+	double riskFreeRate;
+	double volatility;
+
+	double drift(double, double s) const { return riskFreeRate * s; }
+	double diffusion(double, double s) const { return volatility * s; }
+	double diffusionSlope(double, double) const { return volatility; }
+};
+
+// Constant elasticity of variance:  dS = r S dt + sigma S^beta dW.  beta = 1 is GBM; for
+// beta < 1 the volatility rises as the price falls (a skew), and the price can reach zero,
+// where it is absorbed.  sigma is not a Black-Scholes volatility unless beta = 1:  the
+// local volatility at S is sigma S^(beta - 1).
+struct CevModel
+{
+	static constexpr int numFactors = 1;
+
+	double riskFreeRate;
+	double volatility;		// sigma
+	double elasticity;		// beta
+
+	double drift(double, double s) const { return riskFreeRate * s; }
+	double diffusion(double, double s) const { return volatility * std::pow(std::max(s, 0.0), elasticity); }
+	double diffusionSlope(double, double s) const
+	{
+		return s > 0.0 ? volatility * elasticity * std::pow(s, elasticity - 1.0) : 0.0;
+	}
+};
+
+// Local volatility:  dS = r S dt + sigma(t, S) S dW, with sigma(t, S) given by any function
+// object localVolatility(t, s), for instance an interpolated Dupire surface.  The slope for
+// the Milstein scheme is a central difference with a relative bump of 1e-4.
+template<typename VolFunction>
+struct LocalVolModel
+{
+	static constexpr int numFactors = 1;
+
+	double riskFreeRate;
+	VolFunction localVolatility;
+
+	double drift(double, double s) const { return riskFreeRate * s; }
+	double diffusion(double t, double s) const { return localVolatility(t, s) * s; }
+	double diffusionSlope(double t, double s) const
+	{
+		double h = std::max(1.0e-4 * s, 1.0e-8);
+		return (diffusion(t, s + h) - diffusion(t, std::max(s - h, 0.0))) / (s + h - std::max(s - h, 0.0));
+	}
+};
+
+// Heston stochastic volatility:
+//		dS = r S dt + sqrt(v) S dW_1
+//		dv = kappa (theta - v) dt + xi sqrt(v) dW_2,		d<W_1, W_2> = rho dt
+// Two factors:  each time step takes two normal variates per path.
+struct HestonModel
+{
+	static constexpr int numFactors = 2;
+
+	double riskFreeRate;
+	double initialVariance;		// v(0)
+	double meanReversion;		// kappa
+	double longRunVariance;		// theta
+	double volOfVol;			// xi
+	double correlation;			// rho
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,1889 @@
+#include "SobolDirectionNumbers.h"
+
+// Dimension d = 2, 3, ... per line.  Generated from new-joe-kuo-6.21201, keeping the
+// first s columns of each row.
+const std::uint16_t joeKuoInitialNumbers[] =
+{
+	1,
+	1, 3,
+	1, 3, 1,
+	1, 1, 1,
+	1, 1, 3, 3,
+	1, 3, 5, 13,
+	1, 1, 5, 5, 17,
+	1, 1, 5, 5, 5,
+	1, 1, 7, 11, 19,
+	1, 1, 5, 1, 1,
+	1, 1, 1, 3, 11,
+	1, 3, 5, 5, 31,
+	1, 3, 3, 9, 7, 49,
+	1, 1, 1, 15, 21, 21,
+	1, 3, 1, 13, 27, 49,
+	1, 1, 1, 15, 7, 5,
+	1, 3, 1, 15, 13, 25,
+	1, 1, 5, 5, 19, 61,
+	1, 3, 7, 11, 23, 15, 103,
+	1, 3, 7, 13, 13, 15, 69,
+	1, 1, 3, 13, 7, 35, 63,
+	1, 3, 5, 9, 1, 25, 53,
+	1, 3, 1, 13, 9, 35, 107,
+	1, 3, 1, 5, 27, 61, 31,
+	1, 1, 5, 11, 19, 41, 61,
+	1, 3, 5, 3, 3, 13, 69,
+	1, 1, 7, 13, 1, 19, 1,
+	1, 3, 7, 5, 13, 19, 59,
+	1, 1, 3, 9, 25, 29, 41,
+	1, 3, 5, 13, 23, 1, 55,
+	1, 3, 7, 3, 13, 59, 17,
+	1, 3, 1, 3, 5, 53, 69,
+	1, 1, 5, 5, 23, 33, 13,
+	1, 1, 7, 7, 1, 61, 123,
+	1, 1, 7, 9, 13, 61, 49,
+	1, 3, 3, 5, 3, 55, 33,
+	1, 3, 1, 15, 31, 13, 49, 245,
+	1, 3, 5, 15, 31, 59, 63, 97,
+	1, 3, 1, 11, 11, 11, 77, 249,
+	1, 3, 1, 11, 27, 43, 71, 9,
+	1, 1, 7, 15, 21, 11, 81, 45,
+	1, 3, 7, 3, 25, 31, 65, 79,
+	1, 3, 1, 1, 19, 11, 3, 205,
+	1, 1, 5, 9, 19, 21, 29, 157,
+	1, 3, 7, 11, 1, 33, 89, 185,
+	1, 3, 3, 3, 15, 9, 79, 71,
+	1, 3, 7, 11, 15, 39, 119, 27,
+	1, 1, 3, 1, 11, 31, 97, 225,
+	1, 1, 1, 3, 23, 43, 57, 177,
+	1, 3, 7, 7, 17, 17, 37, 71,
+	1, 3, 1, 5, 27, 63, 123, 213,
+	1, 1, 3, 5, 11, 43, 53, 133,
+	1, 3, 5, 5, 29, 17, 47, 173, 479,
+	1, 3, 3, 11, 3, 1, 109, 9, 69,
+	1, 1, 1, 5, 17, 39, 23, 5, 343,
+	1, 3, 1, 5, 25, 15, 31, 103, 499,
+	1, 1, 1, 11, 11, 17, 63, 105, 183,
+	1, 1, 5, 11, 9, 29, 97, 231, 363,
+	1, 1, 5, 15, 19, 45, 41, 7, 383,
+	1, 3, 7, 7, 31, 19, 83, 137, 221,
+	1, 1, 1, 3, 23, 15, 111, 223, 83,
+	1, 1, 5, 13, 31, 15, 55, 25, 161,
+	1, 1, 3, 13, 25, 47, 39, 87, 257,
+	1, 1, 1, 11, 21, 53, 125, 249, 293,
+	1, 1, 7, 11, 11, 7, 57, 79, 323,
+	1, 1, 5, 5, 17, 13, 81, 3, 131,
+	1, 1, 7, 13, 23, 7, 65, 251, 475,
+	1, 3, 5, 1, 9, 43, 3, 149, 11,
+	1, 1, 3, 13, 31, 13, 13, 255, 487,
+	1, 3, 3, 1, 5, 63, 89, 91, 127,
+	1, 1, 3, 3, 1, 19, 123, 127, 237,
+	1, 1, 5, 7, 23, 31, 37, 243, 289,
+	1, 1, 5, 11, 17, 53, 117, 183, 491,
+	1, 1, 1, 5, 1, 13, 13, 209, 345,
+	1, 1, 3, 15, 1, 57, 115, 7, 33,
+	1, 3, 1, 11, 7, 43, 81, 207, 175,
+	1, 3, 1, 1, 15, 27, 63, 255, 49,
+	1, 3, 5, 3, 27, 61, 105, 171, 305,
+	1, 1, 5, 3, 1, 3, 57, 249, 149,
+	1, 1, 3, 5, 5, 57, 15, 13, 159,
+	1, 1, 1, 11, 7, 11, 105, 141, 225,
+	1, 3, 3, 5, 27, 59, 121, 101, 271,
+	1, 3, 5, 9, 11, 49, 51, 59, 115,
+	1, 1, 7, 1, 23, 45, 125, 71, 419,
+	1, 1, 3, 5, 23, 5, 105, 109, 75,
+	1, 1, 7, 15, 7, 11, 67, 121, 453,
+	1, 3, 7, 3, 9, 13, 31, 27, 449,
+	1, 3, 1, 15, 19, 39, 39, 89, 15,
+	1, 1, 1, 1, 1, 33, 73, 145, 379,
+	1, 3, 1, 15, 15, 43, 29, 13, 483,
+	1, 1, 7, 3, 19, 27, 85, 131, 431,
+	1, 3, 3, 3, 5, 35, 23, 195, 349,
+	1, 3, 3, 7, 9, 27, 39, 59, 297,
+	1, 1, 3, 9, 11, 17, 13, 241, 157,
+	1, 3, 7, 15, 25, 57, 33, 189, 213,
+	1, 1, 7, 1, 9, 55, 73, 83, 217,
+	1, 3, 3, 13, 19, 27, 23, 113, 249,
+	1, 3, 5, 3, 23, 43, 3, 253, 479,
+	1, 1, 5, 5, 11, 5, 45, 117, 217,
+	1, 3, 3, 7, 29, 37, 33, 123, 147,
+	1, 3, 1, 15, 5, 5, 37, 227, 223, 459,
+	1, 1, 7, 5, 5, 39, 63, 255, 135, 487,
+	1, 3, 1, 7, 9, 7, 87, 249, 217, 599,
+	1, 1, 3, 13, 9, 47, 7, 225, 363, 247,
+	1, 3, 7, 13, 19, 13, 9, 67, 9, 737,
+	1, 3, 5, 5, 19, 59, 7, 41, 319, 677,
+	1, 1, 5, 3, 31, 63, 15, 43, 207, 789,
+	1, 1, 7, 9, 13, 39, 3, 47, 497, 169,
+	1, 3, 1, 7, 21, 17, 97, 19, 415, 905,
+	1, 3, 7, 1, 3, 31, 71, 111, 165, 127,
+	1, 1, 5, 11, 1, 61, 83, 119, 203, 847,
+	1, 3, 3, 13, 9, 61, 19, 97, 47, 35,
+	1, 1, 7, 7, 15, 29, 63, 95, 417, 469,
+	1, 3, 1, 9, 25, 9, 71, 57, 213, 385,
+	1, 3, 5, 13, 31, 47, 101, 57, 39, 341,
+	1, 1, 3, 3, 31, 57, 125, 173, 365, 551,
+	1, 3, 7, 1, 13, 57, 67, 157, 451, 707,
+	1, 1, 1, 7, 21, 13, 105, 89, 429, 965,
+	1, 1, 5, 9, 17, 51, 45, 119, 157, 141,
+	1, 3, 7, 7, 13, 45, 91, 9, 129, 741,
+	1, 3, 7, 1, 23, 57, 67, 141, 151, 571,
+	1, 1, 3, 11, 17, 47, 93, 107, 375, 157,
+	1, 3, 3, 5, 11, 21, 43, 51, 169, 915,
+	1, 1, 5, 3, 15, 55, 101, 67, 455, 625,
+	1, 3, 5, 9, 1, 23, 29, 47, 345, 595,
+	1, 3, 7, 7, 5, 49, 29, 155, 323, 589,
+	1, 3, 3, 7, 5, 41, 127, 61, 261, 717,
+	1, 3, 7, 7, 17, 23, 117, 67, 129, 1009,
+	1, 1, 3, 13, 11, 39, 21, 207, 123, 305,
+	1, 1, 3, 9, 29, 3, 95, 47, 231, 73,
+	1, 3, 1, 9, 1, 29, 117, 21, 441, 259,
+	1, 3, 1, 13, 21, 39, 125, 211, 439, 723,
+	1, 1, 7, 3, 17, 63, 115, 89, 49, 773,
+	1, 3, 7, 13, 11, 33, 101, 107, 63, 73,
+	1, 1, 5, 5, 13, 57, 63, 135, 437, 177,
+	1, 1, 3, 7, 27, 63, 93, 47, 417, 483,
+	1, 1, 3, 1, 23, 29, 1, 191, 49, 23,
+	1, 1, 3, 15, 25, 55, 9, 101, 219, 607,
+	1, 3, 1, 7, 7, 19, 51, 251, 393, 307,
+	1, 3, 3, 3, 25, 55, 17, 75, 337, 3,
+	1, 1, 1, 13, 25, 17, 65, 45, 479, 413,
+	1, 1, 7, 7, 27, 49, 99, 161, 213, 727,
+	1, 3, 5, 1, 23, 5, 43, 41, 251, 857,
+	1, 3, 3, 7, 11, 61, 39, 87, 383, 835,
+	1, 1, 3, 15, 13, 7, 29, 7, 505, 923,
+	1, 3, 7, 1, 5, 31, 47, 157, 445, 501,
+	1, 1, 3, 7, 1, 43, 9, 147, 115, 605,
+	1, 3, 3, 13, 5, 1, 119, 211, 455, 1001,
+	1, 1, 3, 5, 13, 19, 3, 243, 75, 843,
+	1, 3, 7, 7, 1, 19, 91, 249, 357, 589,
+	1, 1, 1, 9, 1, 25, 109, 197, 279, 411,
+	1, 3, 1, 15, 23, 57, 59, 135, 191, 75,
+	1, 1, 5, 15, 29, 21, 39, 253, 383, 349,
+	1, 3, 3, 5, 19, 45, 61, 151, 199, 981,
+	1, 3, 5, 13, 9, 61, 107, 141, 141, 1,
+	1, 3, 1, 11, 27, 25, 85, 105, 309, 979,
+	1, 3, 3, 11, 19, 7, 115, 223, 349, 43,
+	1, 1, 7, 9, 21, 39, 123, 21, 275, 927,
+	1, 1, 7, 13, 15, 41, 47, 243, 303, 437,
+	1, 1, 1, 7, 7, 3, 15, 99, 409, 719,
+	1, 3, 3, 15, 27, 49, 113, 123, 113, 67, 469,
+	1, 3, 7, 11, 3, 23, 87, 169, 119, 483, 199,
+	1, 1, 5, 15, 7, 17, 109, 229, 179, 213, 741,
+	1, 1, 5, 13, 11, 17, 25, 135, 403, 557, 1433,
+	1, 3, 1, 1, 1, 61, 67, 215, 189, 945, 1243,
+	1, 1, 7, 13, 17, 33, 9, 221, 429, 217, 1679,
+	1, 1, 3, 11, 27, 3, 15, 93, 93, 865, 1049,
+	1, 3, 7, 7, 25, 41, 121, 35, 373, 379, 1547,
+	1, 3, 3, 9, 11, 35, 45, 205, 241, 9, 59,
+	1, 3, 1, 7, 3, 51, 7, 177, 53, 975, 89,
+	1, 1, 3, 5, 27, 1, 113, 231, 299, 759, 861,
+	1, 3, 3, 15, 25, 29, 5, 255, 139, 891, 2031,
+	1, 3, 1, 1, 13, 9, 109, 193, 419, 95, 17,
+	1, 1, 7, 9, 3, 7, 29, 41, 135, 839, 867,
+	1, 1, 7, 9, 25, 49, 123, 217, 113, 909, 215,
+	1, 1, 7, 3, 23, 15, 43, 133, 217, 327, 901,
+	1, 1, 3, 3, 13, 53, 63, 123, 477, 711, 1387,
+	1, 1, 3, 15, 7, 29, 75, 119, 181, 957, 247,
+	1, 1, 1, 11, 27, 25, 109, 151, 267, 99, 1461,
+	1, 3, 7, 15, 5, 5, 53, 145, 11, 725, 1501,
+	1, 3, 7, 1, 9, 43, 71, 229, 157, 607, 1835,
+	1, 3, 3, 13, 25, 1, 5, 27, 471, 349, 127,
+	1, 1, 1, 1, 23, 37, 9, 221, 269, 897, 1685,
+	1, 1, 3, 3, 31, 29, 51, 19, 311, 553, 1969,
+	1, 3, 7, 5, 5, 55, 17, 39, 475, 671, 1529,
+	1, 1, 7, 1, 1, 35, 47, 27, 437, 395, 1635,
+	1, 1, 7, 3, 13, 23, 43, 135, 327, 139, 389,
+	1, 3, 7, 3, 9, 25, 91, 25, 429, 219, 513,
+	1, 1, 3, 5, 13, 29, 119, 201, 277, 157, 2043,
+	1, 3, 5, 3, 29, 57, 13, 17, 167, 739, 1031,
+	1, 3, 3, 5, 29, 21, 95, 27, 255, 679, 1531,
+	1, 3, 7, 15, 9, 5, 21, 71, 61, 961, 1201,
+	1, 3, 5, 13, 15, 57, 33, 93, 459, 867, 223,
+	1, 1, 1, 15, 17, 43, 127, 191, 67, 177, 1073,
+	1, 1, 1, 15, 23, 7, 21, 199, 75, 293, 1611,
+	1, 3, 7, 13, 15, 39, 21, 149, 65, 741, 319,
+	1, 3, 7, 11, 23, 13, 101, 89, 277, 519, 711,
+	1, 3, 7, 15, 19, 27, 85, 203, 441, 97, 1895,
+	1, 3, 1, 3, 29, 25, 21, 155, 11, 191, 197,
+	1, 1, 7, 5, 27, 11, 81, 101, 457, 675, 1687,
+	1, 3, 1, 5, 25, 5, 65, 193, 41, 567, 781,
+	1, 3, 1, 5, 11, 15, 113, 77, 411, 695, 1111,
+	1, 1, 3, 9, 11, 53, 119, 171, 55, 297, 509,
+	1, 1, 1, 1, 11, 39, 113, 139, 165, 347, 595,
+	1, 3, 7, 11, 9, 17, 101, 13, 81, 325, 1733,
+	1, 3, 1, 1, 21, 43, 115, 9, 113, 907, 645,
+	1, 1, 7, 3, 9, 25, 117, 197, 159, 471, 475,
+	1, 3, 1, 9, 11, 21, 57, 207, 485, 613, 1661,
+	1, 1, 7, 7, 27, 55, 49, 223, 89, 85, 1523,
+	1, 1, 5, 3, 19, 41, 45, 51, 447, 299, 1355,
+	1, 3, 1, 13, 1, 33, 117, 143, 313, 187, 1073,
+	1, 1, 7, 7, 5, 11, 65, 97, 377, 377, 1501,
+	1, 3, 1, 1, 21, 35, 95, 65, 99, 23, 1239,
+	1, 1, 5, 9, 3, 37, 95, 167, 115, 425, 867,
+	1, 3, 3, 13, 1, 37, 27, 189, 81, 679, 773,
+	1, 1, 3, 11, 1, 61, 99, 233, 429, 969, 49,
+	1, 1, 1, 7, 25, 63, 99, 165, 245, 793, 1143,
+	1, 1, 5, 11, 11, 43, 55, 65, 71, 283, 273,
+	1, 1, 5, 5, 9, 3, 101, 251, 355, 379, 1611,
+	1, 1, 1, 15, 21, 63, 85, 99, 49, 749, 1335,
+	1, 1, 5, 13, 27, 9, 121, 43, 255, 715, 289,
+	1, 3, 1, 5, 27, 19, 17, 223, 77, 571, 1415,
+	1, 1, 5, 3, 13, 59, 125, 251, 195, 551, 1737,
+	1, 3, 3, 15, 13, 27, 49, 105, 389, 971, 755,
+	1, 3, 5, 15, 23, 43, 35, 107, 447, 763, 253,
+	1, 3, 5, 11, 21, 3, 17, 39, 497, 407, 611,
+	1, 1, 7, 13, 15, 31, 113, 17, 23, 507, 1995,
+	1, 1, 7, 15, 3, 15, 31, 153, 423, 79, 503,
+	1, 1, 7, 9, 19, 25, 23, 171, 505, 923, 1989,
+	1, 1, 5, 9, 21, 27, 121, 223, 133, 87, 697,
+	1, 1, 5, 5, 9, 19, 107, 99, 319, 765, 1461,
+	1, 1, 3, 3, 19, 25, 3, 101, 171, 729, 187,
+	1, 1, 3, 1, 13, 23, 85, 93, 291, 209, 37,
+	1, 1, 1, 15, 25, 25, 77, 253, 333, 947, 1073,
+	1, 1, 3, 9, 17, 29, 55, 47, 255, 305, 2037,
+	1, 3, 3, 9, 29, 63, 9, 103, 489, 939, 1523,
+	1, 3, 7, 15, 7, 31, 89, 175, 369, 339, 595,
+	1, 3, 7, 13, 25, 5, 71, 207, 251, 367, 665,
+	1, 3, 3, 3, 21, 25, 75, 35, 31, 321, 1603,
+	1, 1, 1, 9, 11, 1, 65, 5, 11, 329, 535,
+	1, 1, 5, 3, 19, 13, 17, 43, 379, 485, 383,
+	1, 3, 5, 13, 13, 9, 85, 147, 489, 787, 1133,
+	1, 3, 1, 1, 5, 51, 37, 129, 195, 297, 1783,
+	1, 1, 3, 15, 19, 57, 59, 181, 455, 697, 2033,
+	1, 3, 7, 1, 27, 9, 65, 145, 325, 189, 201,
+	1, 3, 1, 15, 31, 23, 19, 5, 485, 581, 539,
+	1, 1, 7, 13, 11, 15, 65, 83, 185, 847, 831,
+	1, 3, 5, 7, 7, 55, 73, 15, 303, 511, 1905,
+	1, 3, 5, 9, 7, 21, 45, 15, 397, 385, 597,
+	1, 3, 7, 3, 23, 13, 73, 221, 511, 883, 1265,
+	1, 1, 3, 11, 1, 51, 73, 185, 33, 975, 1441,
+	1, 3, 3, 9, 19, 59, 21, 39, 339, 37, 143,
+	1, 1, 7, 1, 31, 33, 19, 167, 117, 635, 639,
+	1, 1, 1, 3, 5, 13, 59, 83, 355, 349, 1967,
+	1, 1, 1, 5, 19, 3, 53, 133, 97, 863, 983,
+	1, 3, 1, 13, 9, 41, 91, 105, 173, 97, 625,
+	1, 1, 5, 3, 7, 49, 115, 133, 71, 231, 1063,
+	1, 1, 7, 5, 17, 43, 47, 45, 497, 547, 757,
+	1, 3, 5, 15, 21, 61, 123, 191, 249, 31, 631,
+	1, 3, 7, 9, 17, 7, 11, 185, 127, 169, 1951,
+	1, 1, 5, 13, 11, 11, 9, 49, 29, 125, 791,
+	1, 1, 1, 15, 31, 41, 13, 167, 273, 429, 57,
+	1, 3, 5, 3, 27, 7, 35, 209, 65, 265, 1393,
+	1, 3, 1, 13, 31, 19, 53, 143, 135, 9, 1021,
+	1, 1, 7, 13, 31, 5, 115, 153, 143, 957, 623,
+	1, 1, 5, 11, 25, 19, 29, 31, 297, 943, 443,
+	1, 3, 3, 5, 21, 11, 127, 81, 479, 25, 699,
+	1, 1, 3, 11, 25, 31, 97, 19, 195, 781, 705,
+	1, 1, 5, 5, 31, 11, 75, 207, 197, 885, 2037,
+	1, 1, 1, 11, 9, 23, 29, 231, 307, 17, 1497,
+	1, 1, 5, 11, 11, 43, 111, 233, 307, 523, 1259,
+	1, 1, 7, 5, 1, 21, 107, 229, 343, 933, 217,
+	1, 1, 1, 11, 3, 21, 125, 131, 405, 599, 1469,
+	1, 3, 5, 5, 9, 39, 33, 81, 389, 151, 811,
+	1, 1, 7, 7, 7, 1, 59, 223, 265, 529, 2021,
+	1, 3, 1, 3, 9, 23, 85, 181, 47, 265, 49,
+	1, 3, 5, 11, 19, 23, 9, 7, 157, 299, 1983,
+	1, 3, 1, 5, 15, 5, 21, 105, 29, 339, 1041,
+	1, 1, 1, 1, 5, 33, 65, 85, 111, 705, 479,
+	1, 1, 1, 7, 9, 35, 77, 87, 151, 321, 101,
+	1, 1, 5, 7, 17, 1, 51, 197, 175, 811, 1229,
+	1, 3, 3, 15, 23, 37, 85, 185, 239, 543, 731,
+	1, 3, 1, 7, 7, 55, 111, 109, 289, 439, 243,
+	1, 1, 7, 11, 17, 53, 35, 217, 259, 853, 1667,
+	1, 3, 1, 9, 1, 63, 87, 17, 73, 565, 1091,
+	1, 1, 3, 3, 11, 41, 1, 57, 295, 263, 1029,
+	1, 1, 5, 1, 27, 45, 109, 161, 411, 421, 1395,
+	1, 3, 5, 11, 25, 35, 47, 191, 339, 417, 1727,
+	1, 1, 5, 15, 21, 1, 93, 251, 351, 217, 1767,
+	1, 3, 3, 11, 3, 7, 75, 155, 313, 211, 491,
+	1, 3, 3, 5, 11, 9, 101, 161, 453, 913, 1067,
+	1, 1, 3, 1, 15, 45, 127, 141, 163, 727, 1597,
+	1, 3, 3, 7, 1, 33, 63, 73, 73, 341, 1691,
+	1, 3, 5, 13, 15, 39, 53, 235, 77, 99, 949,
+	1, 1, 5, 13, 31, 17, 97, 13, 215, 301, 1927,
+	1, 1, 7, 1, 1, 37, 91, 93, 441, 251, 1131,
+	1, 3, 7, 9, 25, 5, 105, 69, 81, 943, 1459,
+	1, 3, 7, 11, 31, 43, 13, 209, 27, 1017, 501,
+	1, 1, 7, 15, 1, 33, 31, 233, 161, 507, 387,
+	1, 3, 3, 5, 5, 53, 33, 177, 503, 627, 1927,
+	1, 1, 7, 11, 7, 61, 119, 31, 457, 229, 1875,
+	1, 1, 5, 15, 19, 5, 53, 201, 157, 885, 1057,
+	1, 3, 7, 9, 1, 35, 51, 113, 249, 425, 1009,
+	1, 3, 5, 7, 21, 53, 37, 155, 119, 345, 631,
+	1, 3, 5, 7, 15, 31, 109, 69, 503, 595, 1879,
+	1, 3, 3, 1, 25, 35, 65, 131, 403, 705, 503,
+	1, 3, 7, 7, 19, 33, 11, 153, 45, 633, 499,
+	1, 3, 3, 5, 11, 3, 29, 93, 487, 33, 703,
+	1, 1, 3, 15, 21, 53, 107, 179, 387, 927, 1757,
+	1, 1, 3, 7, 21, 45, 51, 147, 175, 317, 361,
+	1, 1, 1, 7, 7, 13, 15, 243, 269, 795, 1965,
+	1, 1, 3, 5, 19, 33, 57, 115, 443, 537, 627,
+	1, 3, 3, 9, 3, 39, 25, 61, 185, 717, 1049,
+	1, 3, 7, 3, 7, 37, 107, 153, 7, 269, 1581,
+	1, 1, 7, 3, 7, 41, 91, 41, 145, 489, 1245,
+	1, 1, 5, 9, 7, 7, 105, 81, 403, 407, 283,
+	1, 1, 7, 9, 27, 55, 29, 77, 193, 963, 949,
+	1, 1, 5, 3, 25, 51, 107, 63, 403, 917, 815,
+	1, 1, 7, 3, 7, 61, 19, 51, 457, 599, 535,
+	1, 3, 7, 1, 23, 51, 105, 153, 239, 215, 1847,
+	1, 1, 3, 5, 27, 23, 79, 49, 495, 45, 1935,
+	1, 1, 1, 11, 11, 47, 55, 133, 495, 999, 1461,
+	1, 1, 3, 15, 27, 51, 93, 17, 355, 763, 1675,
+	1, 3, 1, 3, 1, 3, 79, 119, 499, 17, 995,
+	1, 1, 1, 1, 15, 43, 45, 17, 167, 973, 799,
+	1, 1, 1, 3, 27, 49, 89, 29, 483, 913, 2023,
+	1, 1, 3, 3, 5, 11, 75, 7, 41, 851, 611,
+	1, 3, 1, 3, 7, 57, 39, 123, 257, 283, 507,
+	1, 3, 3, 11, 27, 23, 113, 229, 187, 299, 133,
+	1, 1, 3, 13, 9, 63, 101, 77, 451, 169, 337,
+	1, 3, 7, 3, 3, 59, 45, 195, 229, 415, 409,
+	1, 3, 5, 3, 11, 19, 71, 93, 43, 857, 369,
+	1, 3, 7, 9, 19, 33, 115, 19, 241, 703, 247,
+	1, 3, 5, 11, 5, 35, 21, 155, 463, 1005, 1073,
+	1, 3, 7, 3, 25, 15, 109, 83, 93, 69, 1189,
+	1, 3, 5, 7, 5, 21, 93, 133, 135, 167, 903,
+	1, 1, 7, 7, 3, 59, 121, 161, 285, 815, 1769, 3705,
+	1, 3, 1, 1, 3, 47, 103, 171, 381, 609, 185, 373,
+	1, 3, 3, 15, 23, 33, 107, 131, 441, 445, 689, 2059,
+	1, 3, 3, 11, 7, 53, 101, 167, 435, 803, 1255, 3781,
+	1, 1, 5, 11, 15, 59, 41, 19, 135, 835, 1263, 505,
+	1, 1, 7, 11, 21, 49, 23, 219, 127, 961, 1065, 385,
+	1, 3, 5, 15, 7, 47, 117, 217, 45, 731, 1639, 733,
+	1, 1, 7, 11, 27, 57, 91, 87, 81, 35, 1269, 1007,
+	1, 1, 3, 11, 15, 37, 53, 219, 193, 937, 1899, 3733,
+	1, 3, 5, 3, 13, 11, 27, 19, 199, 393, 965, 2195,
+	1, 3, 1, 3, 5, 1, 37, 173, 413, 1023, 553, 409,
+	1, 3, 1, 7, 15, 29, 123, 95, 255, 373, 1799, 3841,
+	1, 3, 5, 13, 21, 57, 51, 17, 511, 195, 1157, 1831,
+	1, 1, 1, 15, 29, 19, 7, 73, 295, 519, 587, 3523,
+	1, 1, 5, 13, 13, 35, 115, 191, 123, 535, 717, 1661,
+	1, 3, 3, 5, 23, 21, 47, 251, 379, 921, 1119, 297,
+	1, 3, 3, 9, 29, 53, 121, 201, 135, 193, 523, 2943,
+	1, 1, 1, 7, 29, 45, 125, 9, 99, 867, 425, 601,
+	1, 3, 1, 9, 13, 15, 67, 181, 109, 293, 1305, 3079,
+	1, 3, 3, 9, 5, 35, 15, 209, 305, 87, 767, 2795,
+	1, 3, 3, 11, 27, 57, 113, 123, 179, 643, 149, 523,
+	1, 1, 3, 15, 11, 17, 67, 223, 63, 657, 335, 3309,
+	1, 1, 1, 9, 25, 29, 109, 159, 39, 513, 571, 1761,
+	1, 1, 3, 1, 5, 63, 75, 19, 455, 601, 123, 691,
+	1, 1, 1, 3, 21, 5, 45, 169, 377, 513, 1951, 2565,
+	1, 1, 3, 11, 3, 33, 119, 69, 253, 907, 805, 1449,
+	1, 1, 5, 13, 31, 15, 17, 7, 499, 61, 687, 1867,
+	1, 3, 7, 11, 17, 33, 73, 77, 299, 243, 641, 2345,
+	1, 1, 7, 11, 9, 35, 31, 235, 359, 647, 379, 1161,
+	1, 3, 3, 15, 31, 25, 5, 67, 33, 45, 437, 4067,
+	1, 1, 3, 11, 7, 17, 37, 87, 333, 253, 1517, 2921,
+	1, 1, 7, 15, 7, 15, 107, 189, 153, 769, 1521, 3427,
+	1, 3, 5, 13, 5, 61, 113, 37, 293, 393, 113, 43,
+	1, 1, 1, 15, 29, 43, 107, 31, 167, 147, 301, 1021,
+	1, 1, 1, 13, 3, 1, 35, 93, 195, 181, 2027, 1491,
+	1, 3, 3, 3, 13, 33, 77, 199, 153, 221, 1699, 3671,
+	1, 3, 5, 13, 7, 49, 123, 155, 495, 681, 819, 809,
+	1, 3, 5, 15, 27, 61, 117, 189, 183, 887, 617, 4053,
+	1, 1, 1, 7, 31, 59, 125, 235, 389, 369, 447, 1039,
+	1, 3, 5, 1, 5, 39, 115, 89, 249, 377, 431, 3747,
+	1, 1, 1, 5, 7, 47, 59, 157, 77, 445, 699, 3439,
+	1, 1, 3, 5, 11, 21, 19, 75, 11, 599, 1575, 735,
+	1, 3, 5, 3, 19, 13, 41, 69, 199, 143, 1761, 3215,
+	1, 3, 5, 7, 19, 43, 25, 41, 41, 11, 1647, 2783,
+	1, 3, 1, 9, 19, 45, 111, 97, 405, 399, 457, 3219,
+	1, 1, 3, 1, 23, 15, 65, 121, 59, 985, 829, 2259,
+	1, 1, 3, 7, 17, 13, 107, 229, 75, 551, 1299, 2363,
+	1, 1, 5, 5, 21, 57, 23, 199, 509, 139, 2007, 3875,
+	1, 3, 1, 11, 19, 53, 15, 229, 215, 741, 695, 823,
+	1, 3, 7, 1, 29, 3, 17, 163, 417, 559, 549, 319,
+	1, 3, 1, 13, 17, 9, 47, 133, 365, 7, 1937, 1071,
+	1, 3, 5, 7, 19, 37, 55, 163, 301, 249, 689, 2327,
+	1, 3, 5, 13, 11, 23, 61, 205, 257, 377, 615, 1457,
+	1, 3, 5, 1, 23, 37, 13, 75, 331, 495, 579, 3367,
+	1, 1, 1, 9, 1, 23, 49, 129, 475, 543, 883, 2531,
+	1, 3, 1, 5, 23, 59, 51, 35, 343, 695, 219, 369,
+	1, 3, 3, 1, 27, 17, 63, 97, 71, 507, 1929, 613,
+	1, 1, 5, 1, 21, 31, 11, 109, 247, 409, 1817, 2173,
+	1, 1, 3, 15, 23, 9, 7, 209, 301, 23, 147, 1691,
+	1, 1, 7, 5, 5, 19, 37, 229, 249, 277, 1115, 2309,
+	1, 1, 1, 5, 5, 63, 5, 249, 285, 431, 343, 2467,
+	1, 1, 1, 11, 7, 45, 35, 75, 505, 537, 29, 2919,
+	1, 3, 5, 15, 11, 39, 15, 63, 263, 9, 199, 445,
+	1, 3, 3, 3, 27, 63, 53, 171, 227, 63, 1049, 827,
+	1, 1, 3, 13, 7, 11, 115, 183, 179, 937, 1785, 381,
+	1, 3, 1, 11, 13, 15, 107, 81, 53, 295, 1785, 3757,
+	1, 3, 3, 13, 11, 5, 109, 243, 3, 505, 323, 1373,
+	1, 3, 3, 11, 21, 51, 17, 177, 381, 937, 1263, 3889,
+	1, 3, 5, 9, 27, 25, 85, 193, 143, 573, 1189, 2995,
+	1, 3, 5, 11, 13, 9, 81, 21, 159, 953, 91, 1751,
+	1, 1, 3, 3, 27, 61, 11, 253, 391, 333, 1105, 635,
+	1, 3, 3, 15, 9, 57, 95, 81, 419, 735, 251, 1141,
+	1, 1, 5, 9, 31, 39, 59, 13, 319, 807, 1241, 2433,
+	1, 3, 3, 5, 27, 13, 107, 141, 423, 937, 2027, 3233,
+	1, 3, 3, 9, 9, 25, 125, 23, 443, 835, 1245, 847,
+	1, 1, 7, 15, 17, 17, 83, 107, 411, 285, 847, 1571,
+	1, 1, 3, 13, 29, 61, 37, 81, 349, 727, 1453, 1957,
+	1, 3, 7, 11, 31, 13, 59, 77, 273, 591, 1265, 1533,
+	1, 1, 7, 7, 13, 17, 25, 25, 187, 329, 347, 1473,
+	1, 3, 7, 7, 5, 51, 37, 99, 221, 153, 503, 2583,
+	1, 3, 1, 13, 19, 27, 11, 69, 181, 479, 1183, 3229,
+	1, 3, 3, 13, 23, 21, 103, 147, 323, 909, 947, 315,
+	1, 3, 1, 3, 23, 1, 31, 59, 93, 513, 45, 2271,
+	1, 3, 5, 1, 7, 43, 109, 59, 231, 41, 1515, 2385,
+	1, 3, 1, 5, 31, 57, 49, 223, 283, 1013, 11, 701,
+	1, 1, 5, 1, 19, 53, 55, 31, 31, 299, 495, 693,
+	1, 3, 3, 9, 5, 33, 77, 253, 427, 791, 731, 1019,
+	1, 3, 7, 11, 1, 9, 119, 203, 53, 877, 1707, 3499,
+	1, 1, 3, 7, 13, 39, 55, 159, 423, 113, 1653, 3455,
+	1, 1, 3, 5, 21, 47, 51, 59, 55, 411, 931, 251,
+	1, 3, 7, 3, 31, 25, 81, 115, 405, 239, 741, 455,
+	1, 1, 5, 1, 31, 3, 101, 83, 479, 491, 1779, 2225,
+	1, 3, 3, 3, 9, 37, 107, 161, 203, 503, 767, 3435,
+	1, 3, 7, 9, 1, 27, 61, 119, 233, 39, 1375, 4089,
+	1, 1, 5, 9, 1, 31, 45, 51, 369, 587, 383, 2813,
+	1, 3, 7, 5, 31, 7, 49, 119, 487, 591, 1627, 53,
+	1, 1, 7, 1, 9, 47, 1, 223, 369, 711, 1603, 1917,
+	1, 3, 5, 3, 21, 37, 111, 17, 483, 739, 1193, 2775,
+	1, 3, 3, 7, 17, 11, 51, 117, 455, 191, 1493, 3821,
+	1, 1, 5, 9, 23, 39, 99, 181, 343, 485, 99, 1931,
+	1, 3, 1, 7, 29, 49, 31, 71, 489, 527, 1763, 2909,
+	1, 1, 5, 11, 5, 5, 73, 189, 321, 57, 1191, 3685,
+	1, 1, 5, 15, 13, 45, 125, 207, 371, 415, 315, 983,
+	1, 3, 3, 5, 25, 59, 33, 31, 239, 919, 1859, 2709,
+	1, 3, 5, 13, 27, 61, 23, 115, 61, 413, 1275, 3559,
+	1, 3, 7, 15, 5, 59, 101, 81, 47, 967, 809, 3189,
+	1, 1, 5, 11, 31, 15, 39, 25, 173, 505, 809, 2677,
+	1, 1, 5, 9, 19, 13, 95, 89, 511, 127, 1395, 2935,
+	1, 1, 5, 5, 31, 45, 9, 57, 91, 303, 1295, 3215,
+	1, 3, 3, 3, 19, 15, 113, 187, 217, 489, 1285, 1803,
+	1, 1, 3, 1, 13, 29, 57, 139, 255, 197, 537, 2183,
+	1, 3, 1, 15, 11, 7, 53, 255, 467, 9, 757, 3167,
+	1, 3, 3, 15, 21, 13, 9, 189, 359, 323, 49, 333,
+	1, 3, 7, 11, 7, 37, 21, 119, 401, 157, 1659, 1069,
+	1, 1, 5, 7, 17, 33, 115, 229, 149, 151, 2027, 279,
+	1, 1, 5, 15, 5, 49, 77, 155, 383, 385, 1985, 945,
+	1, 3, 7, 3, 7, 55, 85, 41, 357, 527, 1715, 1619,
+	1, 1, 3, 1, 21, 45, 115, 21, 199, 967, 1581, 3807,
+	1, 1, 3, 7, 21, 39, 117, 191, 169, 73, 413, 3417,
+	1, 1, 1, 13, 1, 31, 57, 195, 231, 321, 367, 1027,
+	1, 3, 7, 3, 11, 29, 47, 161, 71, 419, 1721, 437,
+	1, 1, 7, 3, 11, 9, 43, 65, 157, 1, 1851, 823,
+	1, 1, 1, 5, 21, 15, 31, 101, 293, 299, 127, 1321,
+	1, 1, 7, 1, 27, 1, 11, 229, 241, 705, 43, 1475,
+	1, 3, 7, 1, 5, 15, 73, 183, 193, 55, 1345, 49,
+	1, 3, 3, 3, 19, 3, 55, 21, 169, 663, 1675, 137,
+	1, 1, 1, 13, 7, 21, 69, 67, 373, 965, 1273, 2279,
+	1, 1, 7, 7, 21, 23, 17, 43, 341, 845, 465, 3355,
+	1, 3, 5, 5, 25, 5, 81, 101, 233, 139, 359, 2057,
+	1, 1, 3, 11, 15, 39, 55, 3, 471, 765, 1143, 3941,
+	1, 1, 7, 15, 9, 57, 81, 79, 215, 433, 333, 3855,
+	1, 1, 5, 5, 19, 45, 83, 31, 209, 363, 701, 1303,
+	1, 3, 7, 5, 1, 13, 55, 163, 435, 807, 287, 2031,
+	1, 3, 3, 7, 3, 3, 17, 197, 39, 169, 489, 1769,
+	1, 1, 3, 5, 29, 43, 87, 161, 289, 339, 1233, 2353,
+	1, 3, 3, 9, 21, 9, 77, 1, 453, 167, 1643, 2227,
+	1, 1, 7, 1, 15, 7, 67, 33, 193, 241, 1031, 2339,
+	1, 3, 1, 11, 1, 63, 45, 65, 265, 661, 849, 1979,
+	1, 3, 1, 13, 19, 49, 3, 11, 159, 213, 659, 2839,
+	1, 3, 5, 11, 9, 29, 27, 227, 253, 449, 1403, 3427,
+	1, 1, 3, 1, 7, 3, 77, 143, 277, 779, 1499, 475,
+	1, 1, 1, 5, 11, 23, 87, 131, 393, 849, 193, 3189,
+	1, 3, 5, 11, 3, 3, 89, 9, 449, 243, 1501, 1739,
+	1, 3, 1, 9, 29, 29, 113, 15, 65, 611, 135, 3687,
+	1, 1, 1, 9, 21, 19, 39, 151, 395, 501, 1339, 959, 2725,
+	1, 3, 7, 1, 7, 35, 45, 33, 119, 225, 1631, 1695, 1459,
+	1, 1, 1, 3, 25, 55, 37, 79, 167, 907, 1075, 271, 4059,
+	1, 3, 5, 13, 5, 13, 53, 165, 437, 67, 1705, 3177, 8095,
+	1, 3, 3, 13, 27, 57, 95, 55, 443, 245, 1945, 1725, 1929,
+	1, 3, 1, 9, 5, 33, 109, 35, 99, 827, 341, 2401, 2411,
+	1, 1, 5, 9, 7, 33, 43, 39, 87, 799, 635, 3481, 7159,
+	1, 3, 1, 1, 31, 15, 45, 27, 337, 113, 987, 2065, 2529,
+	1, 1, 5, 9, 5, 15, 105, 123, 479, 289, 1609, 2177, 4629,
+	1, 3, 5, 11, 31, 47, 97, 87, 385, 195, 1041, 651, 3271,
+	1, 1, 3, 7, 17, 3, 101, 55, 87, 629, 1687, 1387, 2745,
+	1, 3, 5, 5, 7, 21, 9, 237, 313, 549, 1107, 117, 6183,
+	1, 1, 3, 9, 9, 5, 55, 201, 487, 851, 1103, 2993, 4055,
+	1, 1, 5, 9, 31, 19, 59, 7, 363, 381, 1167, 2057, 5715,
+	1, 3, 3, 15, 23, 63, 19, 227, 387, 827, 487, 1049, 7471,
+	1, 3, 1, 5, 23, 25, 61, 245, 363, 863, 963, 3583, 6475,
+	1, 1, 5, 1, 5, 27, 81, 85, 275, 49, 235, 3291, 1195,
+	1, 1, 5, 7, 23, 53, 85, 107, 511, 779, 1265, 1093, 7859,
+	1, 3, 3, 1, 9, 21, 75, 219, 59, 485, 1739, 3845, 1109,
+	1, 3, 5, 1, 13, 41, 19, 143, 293, 391, 2023, 1791, 4399,
+	1, 3, 7, 15, 21, 13, 21, 195, 215, 413, 523, 2099, 2341,
+	1, 1, 1, 3, 29, 51, 47, 57, 135, 575, 943, 1673, 541,
+	1, 3, 5, 1, 9, 13, 113, 175, 447, 115, 657, 4077, 5973,
+	1, 1, 1, 11, 17, 41, 37, 95, 297, 579, 911, 2207, 2387,
+	1, 3, 5, 3, 23, 11, 23, 231, 93, 667, 711, 1563, 7961,
+	1, 1, 7, 3, 17, 59, 13, 181, 141, 991, 1817, 457, 1711,
+	1, 3, 3, 5, 31, 59, 81, 205, 245, 537, 1049, 997, 1815,
+	1, 3, 7, 5, 17, 13, 9, 79, 17, 185, 5, 2211, 6263,
+	1, 3, 7, 13, 7, 53, 61, 145, 13, 285, 1203, 947, 2933,
+	1, 1, 7, 3, 31, 19, 69, 217, 47, 441, 1893, 673, 4451,
+	1, 1, 1, 1, 25, 9, 23, 225, 385, 629, 603, 3747, 4241,
+	1, 3, 1, 9, 5, 37, 31, 237, 431, 79, 1521, 459, 2523,
+	1, 3, 7, 3, 9, 43, 105, 179, 5, 225, 799, 1777, 4893,
+	1, 1, 3, 1, 29, 45, 29, 159, 267, 247, 455, 847, 3909,
+	1, 1, 3, 7, 25, 21, 121, 57, 467, 275, 719, 1521, 7319,
+	1, 3, 1, 3, 11, 35, 119, 123, 81, 979, 1187, 3623, 4293,
+	1, 1, 1, 7, 15, 25, 121, 235, 25, 487, 873, 1787, 1977,
+	1, 1, 1, 11, 3, 7, 17, 135, 345, 353, 383, 4011, 2573,
+	1, 3, 7, 15, 27, 13, 97, 123, 65, 675, 951, 1285, 6559,
+	1, 3, 7, 3, 7, 1, 71, 19, 325, 765, 337, 1197, 2697,
+	1, 3, 5, 1, 31, 37, 11, 71, 169, 283, 83, 3801, 7083,
+	1, 1, 3, 15, 17, 29, 83, 65, 275, 679, 1749, 4007, 7749,
+	1, 1, 3, 1, 21, 11, 41, 95, 237, 361, 1819, 2783, 2383,
+	1, 3, 7, 11, 29, 57, 111, 187, 465, 145, 605, 1987, 8109,
+	1, 1, 3, 3, 19, 15, 55, 83, 357, 1001, 643, 1517, 6529,
+	1, 3, 1, 5, 29, 35, 73, 23, 77, 619, 1523, 1725, 8145,
+	1, 1, 5, 5, 19, 23, 7, 197, 449, 337, 717, 2921, 315,
+	1, 3, 5, 9, 7, 63, 117, 97, 97, 813, 1925, 2817, 1579,
+	1, 1, 1, 11, 31, 7, 25, 235, 231, 133, 1007, 1371, 1553,
+	1, 1, 7, 5, 19, 7, 47, 171, 267, 243, 1331, 567, 6033,
+	1, 1, 5, 1, 7, 49, 55, 89, 109, 735, 1455, 3193, 6239,
+	1, 1, 1, 7, 1, 61, 9, 103, 3, 929, 1481, 2927, 2957,
+	1, 1, 5, 13, 17, 21, 75, 49, 255, 1019, 1161, 2133, 1177,
+	1, 3, 1, 3, 13, 15, 41, 247, 211, 409, 1163, 523, 2635,
+	1, 3, 7, 7, 21, 59, 91, 149, 479, 391, 681, 2311, 6249,
+	1, 1, 5, 11, 27, 53, 21, 211, 197, 815, 719, 1605, 255,
+	1, 1, 3, 3, 9, 33, 59, 3, 323, 1, 101, 1135, 8105,
+	1, 3, 3, 1, 29, 5, 17, 141, 51, 991, 841, 327, 3859,
+	1, 3, 1, 5, 11, 19, 23, 89, 175, 173, 165, 2881, 1881,
+	1, 1, 1, 15, 13, 51, 87, 39, 495, 611, 1341, 1531, 7029,
+	1, 1, 3, 11, 13, 55, 75, 185, 57, 61, 1917, 2051, 5965,
+	1, 1, 5, 5, 7, 53, 11, 217, 213, 933, 921, 3607, 5175,
+	1, 3, 3, 5, 17, 53, 103, 251, 369, 781, 1319, 3717, 4439,
+	1, 3, 5, 13, 1, 39, 25, 235, 321, 773, 251, 3111, 6397,
+	1, 1, 7, 3, 31, 5, 25, 29, 325, 385, 1313, 127, 4705,
+	1, 1, 5, 15, 15, 27, 15, 85, 239, 243, 1633, 3473, 2621,
+	1, 3, 3, 3, 9, 19, 113, 13, 137, 165, 25, 2957, 7549,
+	1, 3, 1, 3, 11, 21, 3, 97, 417, 183, 1205, 1437, 247,
+	1, 1, 7, 3, 17, 21, 125, 55, 67, 387, 385, 2323, 887,
+	1, 3, 5, 5, 29, 11, 103, 223, 233, 641, 133, 415, 1297,
+	1, 3, 3, 11, 1, 9, 5, 189, 235, 1007, 1363, 3985, 889,
+	1, 3, 7, 9, 23, 19, 19, 183, 269, 403, 1643, 3559, 5189,
+	1, 3, 7, 3, 29, 45, 17, 69, 475, 149, 1291, 2689, 7625,
+	1, 3, 7, 3, 27, 37, 41, 73, 253, 1001, 431, 1111, 7887,
+	1, 1, 7, 5, 3, 7, 87, 143, 289, 495, 631, 3011, 6151,
+	1, 1, 1, 13, 5, 45, 17, 167, 23, 975, 801, 1975, 6833,
+	1, 3, 1, 11, 7, 21, 39, 23, 213, 429, 1301, 2059, 197,
+	1, 3, 3, 15, 3, 57, 121, 133, 29, 711, 1961, 2497, 189,
+	1, 1, 3, 5, 11, 55, 115, 137, 233, 673, 985, 2849, 5911,
+	1, 1, 7, 15, 29, 45, 1, 241, 329, 323, 925, 2821, 3331,
+	1, 1, 5, 7, 13, 31, 81, 105, 199, 145, 195, 1365, 5119,
+	1, 3, 7, 11, 3, 55, 11, 31, 117, 343, 1265, 1837, 2451,
+	1, 1, 3, 7, 29, 57, 61, 179, 429, 591, 177, 1945, 2159,
+	1, 3, 5, 11, 23, 49, 101, 137, 339, 323, 1035, 1749, 7737,
+	1, 3, 1, 13, 21, 35, 55, 79, 19, 269, 1055, 2651, 7083,
+	1, 3, 3, 11, 9, 9, 95, 167, 437, 361, 1185, 4083, 603,
+	1, 1, 1, 7, 31, 61, 77, 65, 489, 657, 691, 2423, 4147,
+	1, 3, 5, 7, 21, 37, 87, 191, 311, 453, 2013, 829, 2619,
+	1, 1, 5, 9, 17, 47, 35, 101, 5, 813, 1157, 1279, 7365,
+	1, 1, 5, 3, 11, 35, 113, 199, 369, 721, 901, 1471, 7801,
+	1, 3, 1, 5, 9, 61, 83, 157, 391, 739, 1957, 2123, 4341,
+	1, 3, 5, 11, 19, 19, 111, 225, 383, 219, 997, 717, 7505,
+	1, 3, 1, 11, 13, 63, 35, 127, 209, 831, 501, 3017, 3507,
+	1, 3, 7, 9, 29, 7, 11, 163, 81, 563, 1445, 3215, 6377,
+	1, 3, 7, 11, 25, 3, 39, 195, 491, 45, 839, 4021, 4899,
+	1, 3, 7, 15, 13, 5, 67, 143, 117, 505, 1281, 3679, 5695,
+	1, 3, 7, 9, 9, 19, 21, 221, 147, 763, 683, 2211, 589,
+	1, 1, 3, 5, 21, 47, 53, 109, 299, 807, 1153, 1209, 7961,
+	1, 3, 7, 11, 9, 31, 45, 43, 505, 647, 1127, 2681, 4917,
+	1, 1, 5, 15, 31, 41, 63, 113, 399, 727, 673, 2587, 5259,
+	1, 1, 1, 13, 17, 53, 35, 99, 57, 243, 1447, 1919, 2831,
+	1, 3, 7, 11, 23, 51, 13, 9, 49, 449, 997, 3073, 4407,
+	1, 3, 5, 7, 23, 33, 89, 41, 415, 53, 697, 1113, 1489,
+	1, 1, 3, 7, 1, 13, 29, 13, 255, 749, 77, 3463, 1761,
+	1, 3, 3, 7, 13, 15, 93, 191, 309, 869, 739, 1041, 3053,
+	1, 3, 5, 13, 5, 19, 109, 211, 347, 839, 893, 2947, 7735,
+	1, 3, 1, 13, 27, 3, 119, 157, 485, 99, 1703, 3895, 573,
+	1, 3, 7, 11, 1, 23, 123, 105, 31, 359, 275, 1775, 3685,
+	1, 3, 3, 5, 27, 11, 125, 3, 413, 199, 2043, 2895, 2945,
+	1, 3, 3, 3, 15, 49, 121, 159, 233, 543, 193, 4007, 321,
+	1, 1, 3, 5, 9, 47, 87, 1, 51, 1011, 1595, 2239, 6467,
+	1, 3, 7, 9, 1, 33, 87, 137, 469, 749, 1413, 805, 6817,
+	1, 3, 1, 13, 19, 45, 95, 227, 29, 677, 1275, 3395, 4451,
+	1, 1, 7, 5, 7, 63, 33, 71, 443, 561, 1311, 3069, 6943,
+	1, 1, 1, 13, 9, 37, 23, 69, 13, 415, 1479, 1197, 861,
+	1, 3, 3, 13, 27, 21, 13, 233, 105, 777, 345, 2443, 1105,
+	1, 1, 7, 11, 23, 13, 21, 147, 221, 549, 73, 2729, 6279,
+	1, 1, 7, 7, 25, 27, 15, 45, 227, 39, 75, 1191, 3563,
+	1, 1, 5, 7, 13, 49, 99, 167, 227, 13, 353, 1047, 8075,
+	1, 1, 3, 13, 31, 9, 27, 7, 461, 737, 1559, 3243, 53,
+	1, 3, 1, 1, 21, 41, 97, 165, 171, 821, 587, 2137, 2293,
+	1, 3, 1, 11, 17, 41, 29, 187, 87, 599, 1467, 1395, 5931,
+	1, 1, 1, 9, 9, 49, 89, 205, 409, 453, 61, 1923, 1257,
+	1, 3, 7, 3, 9, 43, 89, 143, 431, 83, 1243, 1795, 3599,
+	1, 3, 5, 13, 3, 25, 59, 219, 43, 223, 797, 2651, 6015,
+	1, 1, 5, 15, 7, 55, 65, 207, 213, 311, 1287, 1269, 6467,
+	1, 3, 7, 11, 21, 57, 31, 183, 351, 857, 911, 1683, 7155,
+	1, 3, 5, 11, 27, 1, 21, 47, 387, 383, 1593, 115, 3805,
+	1, 3, 1, 1, 13, 23, 87, 173, 181, 619, 1653, 3931, 6073,
+	1, 1, 7, 5, 17, 43, 37, 61, 307, 621, 1785, 55, 115,
+	1, 3, 7, 15, 25, 61, 123, 15, 237, 671, 1473, 467, 1907,
+	1, 1, 7, 5, 29, 57, 75, 237, 85, 699, 159, 3577, 4771,
+	1, 1, 1, 11, 25, 19, 51, 1, 147, 31, 895, 2617, 625,
+	1, 3, 7, 5, 29, 15, 115, 175, 395, 391, 1141, 1827, 1181,
+	1, 3, 5, 7, 17, 7, 11, 193, 89, 243, 561, 3787, 4551,
+	1, 3, 1, 11, 7, 57, 7, 125, 403, 947, 1261, 409, 8083,
+	1, 1, 5, 13, 21, 63, 115, 233, 231, 921, 1747, 3635, 2519,
+	1, 1, 5, 11, 3, 27, 15, 91, 505, 591, 1451, 3881, 2997,
+	1, 1, 3, 11, 21, 9, 109, 153, 317, 533, 593, 3967, 2797,
+	1, 3, 3, 13, 9, 57, 121, 245, 219, 867, 967, 791, 7095,
+	1, 1, 1, 9, 29, 21, 99, 35, 375, 959, 329, 4087, 7171,
+	1, 1, 1, 9, 11, 17, 17, 97, 89, 135, 631, 3809, 3253,
+	1, 1, 1, 15, 21, 51, 91, 249, 459, 801, 757, 2353, 2033,
+	1, 3, 5, 9, 23, 29, 77, 53, 399, 767, 1817, 2171, 1629,
+	1, 1, 3, 5, 29, 5, 43, 121, 17, 859, 1479, 3785, 6641,
+	1, 1, 3, 7, 7, 61, 45, 109, 371, 833, 91, 153, 4553,
+	1, 1, 3, 11, 7, 55, 81, 123, 389, 139, 1933, 891, 1789,
+	1, 3, 7, 15, 25, 17, 93, 165, 503, 717, 1553, 1475, 1627,
+	1, 1, 1, 13, 13, 63, 13, 225, 357, 571, 33, 4073, 3795,
+	1, 1, 3, 11, 1, 31, 107, 145, 407, 961, 501, 2987, 103,
+	1, 1, 7, 1, 23, 63, 49, 193, 173, 281, 25, 2465, 5927,
+	1, 1, 7, 1, 1, 1, 85, 77, 273, 693, 349, 1239, 4503,
+	1, 1, 5, 11, 7, 61, 9, 121, 25, 357, 1443, 405, 7827,
+	1, 1, 7, 13, 11, 53, 11, 207, 145, 211, 1703, 1081, 2117,
+	1, 1, 3, 11, 27, 23, 19, 9, 297, 279, 1481, 2273, 6387,
+	1, 3, 3, 5, 15, 45, 3, 41, 305, 87, 1815, 3461, 5349,
+	1, 3, 3, 13, 9, 37, 79, 125, 259, 561, 1087, 4091, 793,
+	1, 3, 5, 7, 31, 55, 7, 145, 347, 929, 589, 2783, 5905,
+	1, 1, 7, 15, 3, 25, 1, 181, 13, 243, 653, 2235, 7445,
+	1, 3, 5, 5, 17, 53, 65, 7, 33, 583, 1363, 1313, 2319,
+	1, 3, 3, 7, 27, 47, 97, 201, 187, 321, 63, 1515, 7917,
+	1, 1, 3, 5, 23, 9, 3, 165, 61, 19, 1789, 3783, 3037,
+	1, 3, 1, 13, 15, 43, 125, 191, 67, 273, 1551, 2227, 5253,
+	1, 1, 1, 13, 25, 53, 107, 33, 299, 249, 1475, 2233, 907,
+	1, 3, 5, 1, 23, 37, 85, 17, 207, 643, 665, 2933, 5199,
+	1, 1, 7, 7, 25, 57, 59, 41, 15, 751, 751, 1749, 7053,
+	1, 3, 3, 1, 13, 25, 127, 93, 281, 613, 875, 2223, 6345,
+	1, 1, 5, 3, 29, 55, 79, 249, 43, 317, 533, 995, 1991,
+	1, 3, 3, 15, 17, 49, 79, 31, 193, 233, 1437, 2615, 819,
+	1, 1, 5, 15, 25, 3, 123, 145, 377, 9, 455, 1191, 3953,
+	1, 3, 5, 3, 15, 19, 41, 231, 81, 393, 3, 19, 2409,
+	1, 1, 3, 1, 27, 43, 113, 179, 7, 853, 947, 2731, 297,
+	1, 1, 1, 11, 29, 39, 53, 191, 443, 689, 529, 3329, 7431,
+	1, 3, 7, 5, 3, 29, 19, 67, 441, 113, 949, 2769, 4169,
+	1, 3, 5, 11, 11, 55, 85, 169, 215, 815, 803, 2345, 3967,
+	1, 1, 7, 9, 5, 45, 111, 5, 419, 375, 303, 1725, 4489,
+	1, 3, 5, 15, 29, 43, 79, 19, 23, 417, 381, 541, 4923,
+	1, 1, 3, 15, 3, 31, 117, 39, 117, 305, 1227, 1223, 143,
+	1, 1, 5, 9, 5, 47, 87, 239, 181, 353, 1561, 3313, 1921,
+	1, 3, 3, 1, 3, 15, 53, 221, 441, 987, 1997, 2529, 8059,
+	1, 1, 7, 11, 15, 57, 111, 139, 137, 883, 1881, 2823, 5661,
+	1, 3, 5, 5, 21, 11, 5, 13, 27, 973, 587, 1331, 1373,
+	1, 1, 7, 11, 29, 51, 93, 29, 217, 221, 55, 2477, 1979,
+	1, 3, 3, 13, 3, 11, 49, 75, 379, 371, 1441, 793, 7633,
+	1, 1, 1, 13, 19, 45, 89, 249, 91, 649, 1695, 915, 5619,
+	1, 3, 1, 7, 7, 29, 1, 77, 313, 895, 519, 771, 295,
+	1, 3, 1, 15, 5, 3, 1, 57, 331, 109, 485, 2853, 6831,
+	1, 1, 1, 15, 17, 3, 35, 99, 245, 971, 839, 2509, 2803,
+	1, 3, 3, 3, 9, 37, 57, 251, 325, 317, 529, 1313, 6379,
+	1, 1, 1, 15, 25, 59, 1, 119, 95, 15, 795, 2375, 6463,
+	1, 3, 1, 5, 1, 49, 117, 21, 47, 179, 863, 85, 1669,
+	1, 3, 7, 3, 9, 37, 19, 221, 455, 973, 571, 1427, 817,
+	1, 1, 1, 15, 17, 9, 67, 213, 127, 887, 1299, 2913, 7451,
+	1, 3, 1, 13, 27, 27, 41, 43, 171, 623, 691, 391, 4885,
+	1, 3, 1, 13, 17, 17, 123, 239, 143, 227, 1151, 519, 6543,
+	1, 3, 7, 5, 7, 63, 97, 39, 101, 555, 1057, 381, 7891,
+	1, 3, 5, 1, 3, 27, 85, 129, 161, 875, 1945, 3541, 695,
+	1, 3, 3, 5, 21, 59, 25, 183, 35, 25, 987, 1459, 181,
+	1, 3, 5, 13, 1, 15, 127, 237, 349, 337, 1491, 2383, 7811,
+	1, 3, 5, 5, 31, 5, 109, 51, 409, 733, 1395, 3207, 6049,
+	1, 1, 5, 7, 13, 35, 113, 25, 263, 389, 299, 2521, 1783,
+	1, 3, 7, 11, 15, 47, 97, 73, 55, 75, 113, 2695, 1023,
+	1, 3, 1, 1, 3, 13, 69, 211, 289, 483, 1335, 787, 677,
+	1, 1, 3, 3, 17, 7, 37, 77, 505, 137, 1113, 345, 2975,
+	1, 1, 1, 13, 3, 11, 95, 199, 453, 109, 479, 3725, 239,
+	1, 1, 7, 15, 19, 53, 3, 145, 359, 863, 347, 3833, 3043,
+	1, 1, 7, 15, 25, 63, 127, 129, 125, 195, 155, 2211, 8153,
+	1, 1, 7, 13, 9, 49, 121, 115, 73, 119, 1851, 727, 47,
+	1, 3, 3, 13, 13, 11, 71, 7, 45, 591, 133, 2407, 5563,
+	1, 1, 1, 13, 23, 29, 87, 89, 501, 71, 1759, 1119, 687,
+	1, 1, 7, 7, 13, 7, 13, 183, 53, 951, 1877, 3991, 6771,
+	1, 3, 7, 11, 7, 1, 27, 47, 61, 21, 919, 961, 1091,
+	1, 3, 5, 5, 1, 27, 1, 5, 63, 157, 1297, 1049, 5893,
+	1, 3, 7, 9, 19, 33, 17, 133, 425, 797, 1721, 153, 119,
+	1, 3, 3, 7, 13, 37, 1, 215, 509, 1003, 61, 2353, 7511,
+	1, 1, 7, 1, 29, 19, 31, 79, 199, 555, 1209, 1603, 6089,
+	1, 3, 1, 1, 5, 31, 111, 127, 333, 429, 1863, 3925, 5411,
+	1, 1, 7, 5, 5, 5, 123, 191, 47, 993, 269, 4051, 2111,
+	1, 1, 5, 15, 1, 9, 87, 5, 47, 463, 865, 1813, 7357,
+	1, 3, 1, 3, 23, 63, 123, 83, 511, 777, 63, 1285, 4537,
+	1, 3, 3, 7, 27, 25, 31, 65, 441, 529, 1815, 1893, 323,
+	1, 3, 7, 5, 11, 19, 7, 5, 397, 811, 755, 2883, 4217,
+	1, 3, 1, 13, 9, 21, 13, 7, 271, 539, 1769, 3243, 5325,
+	1, 1, 7, 1, 31, 13, 47, 131, 181, 457, 1559, 2663, 6653,
+	1, 3, 3, 7, 29, 55, 25, 203, 419, 91, 437, 1159, 5691,
+	1, 1, 3, 13, 29, 19, 71, 217, 337, 329, 501, 939, 2205,
+	1, 1, 3, 1, 1, 27, 17, 201, 97, 285, 1269, 4043, 2207,
+	1, 1, 1, 1, 3, 41, 13, 199, 141, 129, 1515, 3129, 5969,
+	1, 3, 3, 9, 3, 17, 119, 41, 271, 933, 877, 701, 2197,
+	1, 1, 1, 7, 15, 47, 3, 195, 115, 821, 725, 843, 6071,
+	1, 3, 5, 15, 17, 33, 85, 65, 297, 571, 1123, 2743, 5727,
+	1, 1, 5, 11, 27, 15, 37, 235, 415, 293, 1439, 2739, 4171,
+	1, 3, 7, 7, 1, 55, 71, 35, 307, 11, 401, 1881, 933,
+	1, 3, 1, 11, 21, 37, 3, 177, 119, 339, 559, 3991, 3437,
+	1, 3, 3, 9, 17, 17, 97, 119, 301, 169, 157, 3267, 2261,
+	1, 3, 3, 9, 29, 3, 111, 101, 355, 869, 375, 2609, 7377,
+	1, 3, 5, 9, 7, 21, 123, 99, 343, 693, 1927, 1605, 4923,
+	1, 1, 3, 5, 13, 31, 99, 17, 75, 385, 1539, 1553, 7077,
+	1, 3, 3, 5, 31, 35, 107, 11, 407, 1019, 1317, 3593, 7203,
+	1, 3, 3, 13, 17, 33, 99, 245, 401, 957, 157, 1949, 1571,
+	1, 3, 1, 11, 27, 15, 11, 109, 429, 307, 1911, 2701, 861,
+	1, 1, 5, 13, 13, 35, 55, 255, 311, 957, 1803, 2673, 5195,
+	1, 1, 1, 11, 19, 3, 89, 37, 211, 783, 1355, 3567, 7135,
+	1, 1, 5, 5, 21, 49, 79, 17, 509, 331, 183, 3831, 855,
+	1, 3, 7, 5, 29, 19, 85, 109, 105, 523, 845, 3385, 7477,
+	1, 1, 1, 7, 25, 17, 125, 131, 53, 757, 253, 2989, 2939,
+	1, 3, 3, 9, 19, 23, 105, 39, 351, 677, 211, 401, 8103,
+	1, 3, 5, 1, 5, 11, 17, 3, 405, 469, 1569, 2865, 3133,
+	1, 1, 3, 13, 15, 5, 117, 179, 139, 145, 477, 1137, 2537,
+	1, 1, 7, 9, 5, 21, 9, 93, 211, 963, 1207, 3343, 4911,
+	1, 1, 1, 9, 13, 43, 17, 53, 81, 793, 1571, 2523, 3683,
+	1, 3, 3, 13, 25, 21, 5, 59, 489, 987, 1941, 171, 6009,
+	1, 3, 3, 7, 1, 39, 89, 171, 403, 467, 1767, 3423, 2791,
+	1, 1, 3, 9, 19, 49, 91, 125, 163, 1013, 89, 2849, 6785,
+	1, 1, 5, 9, 9, 11, 15, 241, 43, 297, 1719, 1541, 1821,
+	1, 3, 7, 15, 29, 23, 103, 239, 191, 33, 1043, 3649, 6579,
+	1, 3, 3, 9, 21, 51, 123, 55, 223, 645, 1463, 4021, 5891,
+	1, 1, 5, 7, 3, 41, 27, 235, 391, 303, 2021, 3187, 7607,
+	1, 1, 1, 9, 5, 49, 49, 29, 377, 251, 1887, 1017, 1301,
+	1, 1, 3, 3, 13, 41, 27, 47, 223, 23, 517, 3227, 6731,
+	1, 1, 7, 1, 31, 25, 47, 9, 511, 623, 2047, 1263, 1511,
+	1, 1, 3, 15, 15, 23, 53, 1, 261, 595, 85, 241, 7047,
+	1, 3, 3, 11, 17, 5, 81, 73, 149, 781, 2035, 3163, 4247,
+	1, 3, 7, 7, 29, 59, 49, 79, 397, 901, 1105, 2191, 6277,
+	1, 3, 3, 11, 13, 27, 25, 173, 107, 73, 1265, 585, 5251,
+	1, 1, 7, 15, 29, 23, 73, 229, 235, 887, 1469, 4073, 2591,
+	1, 1, 3, 9, 17, 15, 83, 173, 207, 879, 1701, 1509, 11,
+	1, 1, 3, 5, 5, 37, 65, 161, 39, 421, 1153, 2007, 5355,
+	1, 1, 7, 11, 23, 37, 5, 11, 9, 499, 17, 157, 5747,
+	1, 3, 7, 13, 25, 9, 49, 7, 39, 945, 1349, 1759, 1441,
+	1, 1, 5, 3, 21, 15, 113, 81, 265, 837, 333, 3625, 6133,
+	1, 3, 1, 11, 13, 27, 73, 109, 297, 327, 299, 3253, 6957,
+	1, 1, 3, 13, 19, 39, 123, 73, 65, 5, 1061, 2187, 5055,
+	1, 1, 3, 1, 11, 31, 21, 115, 453, 857, 711, 495, 549,
+	1, 3, 7, 7, 15, 29, 79, 103, 47, 713, 1735, 3121, 6321,
+	1, 1, 5, 5, 29, 9, 97, 33, 471, 705, 329, 1501, 1349,
+	1, 3, 3, 1, 21, 9, 111, 209, 71, 47, 491, 2143, 1797,
+	1, 3, 3, 3, 11, 39, 21, 135, 445, 259, 607, 3811, 5449,
+	1, 1, 7, 9, 11, 25, 113, 251, 395, 317, 317, 91, 1979,
+	1, 3, 1, 9, 3, 21, 103, 133, 389, 943, 1235, 1749, 7063,
+	1, 1, 3, 7, 1, 11, 5, 15, 497, 477, 479, 3079, 6969,
+	1, 1, 3, 3, 15, 39, 105, 131, 475, 465, 181, 865, 3813,
+	1, 1, 7, 9, 19, 63, 123, 131, 415, 525, 457, 2471, 3135,
+	1, 3, 7, 15, 25, 35, 123, 45, 341, 805, 485, 4049, 7065,
+	1, 1, 1, 5, 29, 9, 47, 227, 51, 867, 1873, 1593, 2271,
+	1, 1, 7, 15, 31, 9, 71, 117, 285, 711, 837, 1435, 6275,
+	1, 3, 1, 1, 5, 19, 79, 25, 301, 415, 1871, 645, 3251,
+	1, 3, 1, 3, 17, 51, 99, 185, 447, 43, 523, 219, 429,
+	1, 3, 1, 13, 29, 13, 51, 93, 7, 995, 757, 3017, 6865,
+	1, 1, 3, 15, 7, 25, 75, 17, 155, 981, 1231, 1229, 1995,
+	1, 3, 5, 3, 27, 45, 71, 73, 225, 763, 377, 1139, 2863,
+	1, 1, 3, 1, 1, 39, 69, 113, 29, 371, 1051, 793, 3749,
+	1, 1, 3, 13, 23, 61, 27, 183, 307, 431, 1345, 2757, 4031,
+	1, 3, 7, 5, 5, 59, 117, 197, 303, 721, 877, 723, 1601,
+	1, 3, 5, 1, 27, 33, 99, 237, 485, 711, 665, 3077, 5105,
+	1, 1, 3, 1, 13, 9, 103, 201, 23, 951, 2029, 165, 2093,
+	1, 3, 5, 13, 5, 29, 55, 85, 221, 677, 611, 3613, 4567,
+	1, 1, 1, 1, 7, 61, 9, 233, 261, 561, 953, 4023, 2443,
+	1, 3, 3, 13, 1, 17, 103, 71, 223, 213, 833, 1747, 6999,
+	1, 3, 5, 15, 25, 53, 57, 187, 25, 695, 1207, 4089, 2877,
+	1, 1, 7, 1, 7, 31, 87, 129, 493, 519, 1555, 1155, 4637,
+	1, 1, 1, 15, 21, 17, 23, 29, 19, 255, 927, 1791, 3093,
+	1, 1, 3, 9, 17, 33, 95, 129, 175, 461, 287, 2633, 2325,
+	1, 3, 5, 7, 23, 19, 63, 209, 249, 583, 1373, 2039, 2225,
+	1, 3, 3, 5, 5, 19, 79, 241, 459, 355, 1455, 3313, 3639,
+	1, 1, 7, 9, 21, 41, 97, 119, 129, 769, 1541, 3495, 7741,
+	1, 1, 7, 11, 9, 29, 35, 255, 141, 937, 1763, 41, 1393,
+	1, 3, 7, 1, 13, 51, 61, 157, 177, 847, 1829, 3539, 285,
+	1, 1, 1, 15, 21, 13, 9, 55, 397, 19, 1495, 1255, 7235,
+	1, 1, 7, 7, 25, 37, 53, 237, 319, 197, 269, 1205, 1485,
+	1, 1, 5, 15, 23, 17, 35, 247, 323, 807, 233, 3681, 4407,
+	1, 1, 3, 7, 9, 59, 85, 105, 493, 763, 1639, 391, 1451,
+	1, 3, 3, 9, 15, 33, 5, 253, 129, 625, 1527, 2793, 6057,
+	1, 3, 1, 1, 7, 47, 21, 161, 235, 83, 397, 3563, 5953,
+	1, 3, 7, 11, 3, 41, 25, 117, 375, 779, 1297, 3715, 8117,
+	1, 1, 3, 7, 31, 19, 103, 173, 475, 189, 2035, 2921, 1107,
+	1, 1, 7, 3, 25, 7, 93, 255, 307, 113, 1893, 2233, 6919,
+	1, 3, 5, 15, 9, 57, 79, 143, 165, 5, 1389, 193, 693,
+	1, 3, 5, 1, 29, 45, 91, 49, 189, 461, 439, 1283, 7835,
+	1, 1, 3, 13, 11, 61, 41, 231, 373, 695, 395, 915, 5393,
+	1, 3, 7, 11, 5, 51, 67, 53, 483, 95, 1943, 247, 5653,
+	1, 3, 7, 5, 5, 57, 45, 235, 137, 793, 1069, 1661, 1557,
+	1, 3, 5, 3, 25, 55, 103, 177, 81, 861, 1151, 143, 7655,
+	1, 1, 3, 1, 21, 41, 67, 131, 253, 431, 1269, 3181, 3429,
+	1, 3, 1, 1, 21, 7, 77, 221, 257, 663, 71, 2949, 2481,
+	1, 3, 5, 3, 3, 23, 45, 107, 299, 739, 1013, 3, 3165,
+	1, 1, 5, 1, 3, 37, 109, 37, 243, 983, 1221, 1691, 3869,
+	1, 1, 5, 5, 31, 7, 5, 193, 397, 867, 1495, 3435, 7441,
+	1, 1, 1, 1, 17, 59, 97, 233, 389, 597, 1013, 1631, 483,
+	1, 1, 1, 11, 7, 41, 107, 53, 111, 125, 1513, 1921, 7647,
+	1, 3, 3, 3, 31, 29, 117, 3, 365, 971, 1139, 2123, 5913,
+	1, 1, 1, 13, 23, 3, 1, 167, 475, 639, 1811, 3841, 3081,
+	1, 1, 5, 3, 5, 47, 65, 123, 275, 783, 95, 119, 7591,
+	1, 3, 1, 15, 13, 33, 93, 237, 467, 431, 705, 4013, 4035,
+	1, 3, 5, 1, 19, 7, 101, 231, 155, 737, 1381, 3343, 2051,
+	1, 1, 5, 9, 15, 49, 45, 163, 433, 765, 2031, 201, 2589,
+	1, 3, 7, 9, 19, 41, 31, 89, 93, 623, 105, 745, 4409,
+	1, 1, 5, 1, 11, 45, 127, 85, 389, 439, 829, 477, 7965,
+	1, 3, 3, 15, 13, 41, 1, 207, 435, 585, 311, 1725, 2737,
+	1, 3, 3, 3, 13, 49, 21, 31, 197, 799, 1411, 2959, 7133,
+	1, 3, 1, 3, 7, 43, 9, 141, 133, 579, 1059, 93, 957,
+	1, 3, 7, 1, 15, 51, 23, 213, 381, 851, 699, 2261, 3419,
+	1, 3, 5, 9, 25, 35, 67, 141, 35, 409, 1423, 365, 1645,
+	1, 3, 3, 11, 15, 33, 27, 181, 93, 87, 1761, 3511, 1353,
+	1, 3, 5, 3, 25, 63, 111, 137, 321, 819, 705, 1547, 7271,
+	1, 3, 1, 1, 5, 57, 99, 59, 411, 757, 1371, 3953, 3695,
+	1, 3, 5, 11, 11, 21, 25, 147, 239, 455, 709, 953, 7175,
+	1, 3, 3, 15, 5, 53, 91, 205, 341, 63, 723, 1565, 7135,
+	1, 1, 7, 15, 11, 21, 99, 79, 63, 593, 2007, 3629, 5271,
+	1, 3, 3, 1, 9, 21, 45, 175, 453, 435, 1855, 2649, 6959,
+	1, 1, 3, 15, 15, 33, 121, 121, 251, 431, 1127, 3305, 4199,
+	1, 1, 1, 9, 31, 15, 71, 29, 345, 391, 1159, 2809, 345,
+	1, 3, 7, 1, 23, 29, 95, 151, 327, 727, 647, 1623, 2971,
+	1, 1, 7, 7, 9, 29, 79, 91, 127, 909, 1293, 1315, 5315,
+	1, 1, 5, 11, 13, 37, 89, 73, 149, 477, 1909, 3343, 525,
+	1, 3, 5, 7, 5, 59, 55, 255, 223, 459, 2027, 237, 4205,
+	1, 1, 1, 7, 27, 11, 95, 65, 325, 835, 907, 3801, 3787,
+	1, 1, 1, 11, 27, 33, 99, 175, 51, 913, 331, 1851, 4133,
+	1, 3, 5, 5, 13, 37, 31, 99, 273, 409, 1827, 3845, 5491,
+	1, 1, 3, 7, 23, 19, 107, 85, 283, 523, 509, 451, 421,
+	1, 3, 5, 7, 13, 9, 51, 81, 87, 619, 61, 2803, 5271,
+	1, 1, 1, 15, 9, 45, 35, 219, 401, 271, 953, 649, 6847,
+	1, 1, 7, 11, 9, 45, 17, 219, 169, 837, 1483, 1605, 2901,
+	1, 1, 7, 7, 21, 43, 37, 33, 291, 359, 71, 2899, 7037,
+	1, 3, 3, 13, 31, 53, 37, 15, 149, 949, 551, 3445, 5455,
+	1, 3, 1, 5, 19, 45, 81, 223, 193, 439, 2047, 3879, 789,
+	1, 1, 7, 3, 11, 63, 35, 61, 255, 563, 459, 2991, 3359,
+	1, 1, 5, 9, 13, 49, 47, 185, 239, 221, 1533, 3635, 2045,
+	1, 3, 7, 3, 25, 37, 127, 223, 51, 357, 483, 3837, 6873,
+	1, 1, 7, 9, 31, 37, 113, 31, 387, 833, 1243, 1543, 5535,
+	1, 3, 1, 9, 23, 59, 119, 221, 73, 185, 2007, 2885, 2563,
+	1, 1, 1, 13, 7, 33, 53, 179, 67, 185, 1541, 1807, 4659,
+	1, 3, 1, 11, 31, 37, 23, 215, 269, 357, 207, 645, 4219,
+	1, 3, 3, 13, 19, 27, 107, 55, 91, 71, 1695, 1815, 89,
+	1, 1, 3, 15, 3, 19, 35, 247, 49, 529, 1523, 3317, 6151,
+	1, 1, 7, 7, 23, 25, 107, 139, 483, 503, 1277, 243, 7879,
+	1, 3, 3, 13, 3, 15, 11, 197, 135, 839, 985, 275, 5527,
+	1, 3, 5, 3, 25, 47, 95, 21, 113, 307, 1001, 3065, 295,
+	1, 1, 3, 9, 19, 19, 99, 213, 363, 449, 735, 2851, 2521,
+	1, 1, 3, 9, 5, 49, 63, 61, 157, 857, 497, 2801, 6987,
+	1, 1, 1, 9, 1, 41, 109, 119, 499, 939, 867, 3675, 8023,
+	1, 3, 1, 1, 13, 33, 109, 123, 289, 3, 1271, 2773, 4265,
+	1, 3, 1, 11, 9, 57, 83, 221, 95, 43, 1189, 457, 7133,
+	1, 1, 7, 3, 11, 49, 33, 219, 229, 289, 685, 3359, 4495,
+	1, 3, 1, 3, 19, 43, 67, 193, 41, 771, 407, 81, 3891,
+	1, 1, 7, 11, 5, 29, 51, 175, 297, 539, 1, 2245, 6439,
+	1, 3, 7, 15, 21, 33, 117, 183, 511, 489, 1283, 3281, 5979,
+	1, 3, 7, 5, 9, 3, 125, 147, 359, 549, 369, 3049, 2405,
+	1, 3, 5, 7, 19, 5, 65, 97, 483, 377, 1523, 1457, 2995,
+	1, 1, 5, 1, 11, 21, 41, 113, 277, 131, 1475, 1043, 2367,
+	1, 3, 3, 1, 15, 17, 101, 69, 443, 865, 817, 1421, 5231,
+	1, 1, 3, 3, 3, 55, 95, 99, 75, 195, 1929, 3931, 5855,
+	1, 3, 1, 3, 19, 23, 93, 213, 241, 551, 1307, 585, 7729,
+	1, 3, 1, 11, 23, 15, 53, 249, 467, 519, 95, 741, 409,
+	1, 1, 1, 15, 29, 37, 43, 203, 233, 877, 77, 1933, 2729,
+	1, 3, 7, 11, 27, 39, 43, 161, 255, 15, 1463, 833, 495,
+	1, 1, 7, 11, 3, 53, 81, 67, 375, 823, 1903, 3061, 395,
+	1, 1, 1, 1, 15, 37, 93, 233, 247, 501, 1321, 3275, 5409,
+	1, 3, 3, 7, 7, 11, 5, 105, 139, 983, 1239, 531, 3881,
+	1, 1, 5, 3, 19, 49, 107, 227, 361, 101, 355, 2649, 7383,
+	1, 1, 7, 5, 25, 41, 101, 121, 209, 293, 1937, 2259, 5557,
+	1, 1, 3, 7, 7, 1, 9, 13, 463, 1019, 995, 3159, 107,
+	1, 3, 5, 11, 5, 35, 127, 97, 261, 789, 807, 807, 6257,
+	1, 1, 7, 5, 11, 13, 45, 91, 417, 101, 1973, 3645, 2107,
+	1, 1, 3, 7, 5, 63, 57, 49, 203, 157, 115, 1393, 8117,
+	1, 3, 5, 5, 3, 43, 15, 155, 127, 489, 1165, 3701, 4867,
+	1, 1, 7, 7, 29, 29, 69, 215, 415, 367, 371, 1901, 6075,
+	1, 1, 1, 3, 11, 33, 89, 149, 433, 705, 1437, 1597, 505,
+	1, 3, 5, 1, 13, 37, 19, 119, 5, 581, 2037, 1633, 2099,
+	1, 3, 7, 13, 5, 49, 103, 245, 215, 515, 133, 2007, 1933,
+	1, 3, 1, 9, 1, 3, 25, 197, 253, 387, 1683, 2267, 221,
+	1, 3, 5, 15, 21, 9, 73, 201, 405, 999, 437, 3877, 6045,
+	1, 1, 3, 1, 31, 55, 25, 83, 421, 395, 1807, 2129, 7797,
+	1, 1, 3, 1, 23, 21, 121, 183, 125, 347, 143, 3685, 4317,
+	1, 3, 3, 3, 17, 45, 17, 223, 267, 795, 1815, 1309, 155,
+	1, 1, 1, 15, 17, 59, 5, 133, 15, 715, 1503, 153, 2887,
+	1, 1, 1, 1, 27, 13, 119, 77, 243, 995, 1851, 3719, 4695,
+	1, 3, 1, 5, 31, 49, 43, 165, 49, 609, 1265, 1141, 505,
+	1, 1, 7, 13, 11, 63, 21, 253, 229, 585, 1543, 3719, 4141,
+	1, 3, 7, 11, 23, 27, 17, 131, 295, 895, 1493, 1411, 3247,
+	1, 1, 5, 9, 29, 7, 97, 15, 113, 445, 859, 1483, 1121,
+	1, 3, 1, 9, 13, 49, 99, 107, 323, 201, 681, 3071, 5281,
+	1, 1, 1, 15, 9, 19, 61, 161, 7, 87, 587, 2199, 2811,
+	1, 3, 3, 15, 15, 19, 95, 45, 299, 829, 981, 3479, 487,
+	1, 1, 1, 9, 3, 37, 7, 19, 227, 13, 397, 513, 1257,
+	1, 1, 5, 15, 15, 13, 17, 111, 135, 929, 1145, 811, 1801,
+	1, 3, 1, 3, 27, 57, 31, 19, 279, 103, 693, 631, 3409,
+	1, 1, 1, 1, 15, 13, 67, 83, 23, 799, 1735, 2063, 3363,
+	1, 3, 3, 7, 3, 1, 61, 31, 41, 533, 2025, 4067, 6963,
+	1, 1, 5, 7, 17, 27, 81, 79, 107, 205, 29, 97, 4883,
+	1, 1, 1, 5, 19, 49, 91, 201, 283, 949, 651, 3819, 5073,
+	1, 1, 7, 9, 11, 13, 73, 197, 37, 219, 1931, 3369, 6017,
+	1, 1, 7, 15, 11, 7, 75, 205, 7, 819, 399, 661, 6487,
+	1, 3, 3, 3, 27, 37, 95, 41, 307, 165, 1077, 3485, 563,
+	1, 3, 5, 3, 21, 49, 57, 179, 109, 627, 1789, 431, 2941,
+	1, 1, 7, 5, 11, 19, 43, 137, 149, 679, 1543, 245, 1381,
+	1, 3, 5, 5, 15, 3, 69, 81, 135, 159, 1363, 3401, 6355,
+	1, 3, 5, 1, 9, 61, 49, 53, 319, 25, 1647, 1297, 615,
+	1, 3, 5, 11, 31, 43, 9, 101, 71, 919, 335, 3147, 5823,
+	1, 3, 1, 1, 15, 5, 29, 109, 511, 945, 867, 3677, 6915,
+	1, 3, 3, 15, 17, 49, 91, 111, 215, 29, 1879, 97, 2505,
+	1, 3, 1, 13, 19, 61, 11, 111, 163, 777, 533, 1113, 5339,
+	1, 1, 7, 9, 17, 55, 117, 91, 455, 289, 557, 913, 4455,
+	1, 3, 1, 7, 25, 19, 123, 37, 1, 277, 717, 2965, 4469,
+	1, 3, 7, 3, 19, 23, 87, 235, 209, 457, 2041, 2893, 1805,
+	1, 3, 3, 5, 5, 43, 23, 61, 351, 791, 59, 2009, 2909,
+	1, 1, 3, 7, 5, 1, 27, 231, 385, 257, 1261, 2701, 1807,
+	1, 3, 1, 1, 27, 19, 87, 253, 131, 685, 1743, 3983, 2651,
+	1, 3, 7, 11, 21, 17, 11, 81, 191, 641, 1821, 3005, 7251,
+	1, 3, 3, 5, 15, 31, 41, 213, 55, 931, 1953, 49, 6037,
+	1, 1, 7, 15, 7, 27, 65, 223, 113, 79, 1875, 911, 5445,
+	1, 3, 7, 7, 23, 55, 51, 167, 495, 25, 1585, 3447, 799,
+	1, 1, 3, 7, 27, 15, 95, 193, 337, 415, 975, 3085, 967,
+	1, 1, 7, 15, 19, 7, 93, 41, 433, 551, 401, 3169, 3971,
+	1, 1, 7, 11, 13, 15, 53, 69, 433, 59, 1117, 3359, 6231,
+	1, 1, 7, 3, 23, 5, 115, 201, 225, 109, 1903, 3897, 6265,
+	1, 1, 1, 11, 17, 1, 39, 143, 361, 659, 1105, 23, 4923,
+	1, 1, 1, 9, 27, 57, 85, 227, 261, 119, 1881, 3965, 6999,
+	1, 3, 7, 7, 15, 7, 107, 17, 315, 49, 1591, 905, 7789,
+	1, 3, 1, 7, 29, 3, 47, 237, 157, 769, 839, 3199, 3195,
+	1, 1, 3, 15, 25, 39, 63, 15, 111, 857, 881, 1505, 7671,
+	1, 1, 7, 1, 3, 35, 41, 215, 99, 895, 1025, 1483, 4707,
+	1, 3, 5, 1, 1, 31, 25, 247, 113, 841, 397, 1825, 6969,
+	1, 1, 3, 5, 19, 41, 49, 243, 225, 973, 241, 175, 1041,
+	1, 1, 1, 7, 15, 15, 105, 141, 83, 75, 1675, 3523, 5219,
+	1, 1, 7, 5, 13, 27, 47, 199, 445, 841, 959, 1157, 2209,
+	1, 3, 5, 15, 23, 31, 31, 81, 85, 33, 785, 2639, 7799,
+	1, 1, 5, 13, 21, 3, 47, 99, 235, 943, 1731, 2467, 7891,
+	1, 1, 1, 3, 17, 53, 85, 219, 73, 131, 1339, 875, 1191,
+	1, 1, 5, 7, 17, 63, 113, 7, 185, 557, 749, 3563, 4973,
+	1, 3, 3, 15, 15, 21, 43, 111, 155, 689, 345, 423, 3597,
+	1, 1, 5, 1, 15, 29, 93, 5, 361, 713, 695, 3937, 425,
+	1, 3, 7, 7, 13, 41, 115, 175, 315, 937, 123, 2841, 4457,
+	1, 1, 3, 11, 25, 5, 103, 53, 423, 811, 657, 399, 7257,
+	1, 1, 1, 1, 1, 13, 101, 211, 383, 325, 97, 1703, 4429,
+	1, 3, 7, 9, 31, 45, 83, 157, 509, 701, 841, 1105, 3643,
+	1, 1, 1, 7, 1, 9, 69, 17, 129, 281, 1161, 2945, 7693,
+	1, 3, 7, 1, 11, 29, 51, 143, 77, 433, 1723, 2317, 5641,
+	1, 1, 1, 1, 21, 43, 13, 67, 177, 505, 1629, 1267, 4885,
+	1, 1, 3, 11, 27, 63, 111, 47, 233, 781, 453, 1679, 3209,
+	1, 1, 3, 13, 29, 27, 119, 141, 493, 971, 461, 1159, 633,
+	1, 1, 3, 15, 23, 5, 79, 215, 163, 149, 1805, 2399, 61,
+	1, 3, 5, 13, 19, 5, 1, 39, 409, 561, 709, 829, 1357,
+	1, 3, 3, 13, 19, 43, 9, 177, 449, 447, 73, 2107, 5669,
+	1, 3, 5, 1, 23, 13, 63, 109, 203, 593, 829, 4017, 6881,
+	1, 1, 5, 7, 3, 9, 53, 175, 391, 169, 1283, 3793, 4451,
+	1, 1, 5, 7, 29, 43, 9, 5, 209, 77, 927, 2941, 8145,
+	1, 3, 5, 15, 17, 49, 5, 143, 131, 771, 1685, 925, 2175,
+	1, 1, 3, 11, 27, 27, 27, 159, 161, 1015, 1587, 4049, 1983,
+	1, 3, 1, 3, 23, 57, 119, 67, 481, 577, 389, 3319, 5325,
+	1, 3, 5, 1, 19, 39, 87, 61, 329, 657, 1773, 31, 1707,
+	1, 1, 3, 1, 5, 25, 15, 241, 131, 815, 1751, 3029, 8039,
+	1, 3, 3, 13, 27, 13, 77, 87, 437, 57, 621, 1031, 7891,
+	1, 3, 1, 13, 23, 51, 117, 37, 331, 745, 605, 3179, 4713,
+	1, 1, 5, 5, 19, 17, 99, 167, 87, 721, 737, 789, 2165,
+	1, 3, 5, 13, 1, 51, 119, 211, 165, 299, 1327, 3053, 3343,
+	1, 1, 5, 15, 29, 45, 17, 129, 67, 345, 1553, 2705, 7369,
+	1, 1, 1, 9, 23, 7, 13, 209, 7, 407, 317, 3077, 7287,
+	1, 1, 1, 5, 9, 59, 89, 3, 487, 451, 505, 2499, 7563,
+	1, 3, 1, 7, 21, 1, 21, 203, 101, 417, 1389, 2751, 1397,
+	1, 3, 7, 13, 7, 31, 3, 247, 349, 485, 1259, 549, 6321,
+	1, 1, 7, 7, 27, 33, 107, 197, 293, 729, 1753, 2571, 103,
+	1, 3, 5, 9, 25, 35, 5, 253, 137, 213, 2041, 3387, 1809,
+	1, 1, 7, 13, 15, 35, 67, 83, 295, 175, 839, 2831, 839,
+	1, 3, 3, 11, 3, 17, 55, 141, 247, 991, 117, 3799, 1221,
+	1, 1, 5, 1, 11, 37, 87, 233, 457, 653, 899, 2933, 3105,
+	1, 1, 3, 15, 3, 31, 67, 167, 437, 9, 651, 1109, 1139,
+	1, 1, 3, 1, 7, 63, 67, 17, 11, 883, 1855, 1941, 4751,
+	1, 3, 7, 9, 19, 33, 113, 117, 495, 39, 1795, 2561, 5519,
+	1, 1, 7, 5, 1, 3, 103, 37, 201, 223, 1101, 877, 6483,
+	1, 1, 5, 9, 29, 49, 51, 33, 439, 917, 861, 1321, 2135,
+	1, 1, 3, 3, 1, 5, 17, 93, 217, 619, 613, 1357, 6095,
+	1, 3, 1, 11, 3, 21, 5, 41, 15, 175, 843, 2937, 6849,
+	1, 3, 3, 7, 9, 57, 55, 127, 79, 287, 445, 2205, 7989,
+	1, 1, 7, 13, 23, 17, 93, 129, 157, 135, 1747, 1813, 4183,
+	1, 1, 1, 5, 31, 59, 99, 33, 425, 329, 887, 367, 1761,
+	1, 1, 7, 9, 17, 53, 77, 139, 435, 387, 49, 3649, 1773,
+	1, 3, 3, 15, 21, 57, 45, 161, 331, 719, 273, 3479, 4173,
+	1, 1, 3, 9, 3, 3, 105, 201, 373, 877, 919, 1263, 6649,
+	1, 3, 1, 15, 13, 43, 13, 99, 73, 163, 353, 3569, 5601,
+	1, 3, 7, 3, 5, 9, 69, 177, 449, 47, 781, 1125, 4245,
+	1, 1, 1, 5, 3, 45, 1, 123, 409, 903, 205, 2057, 7637,
+	1, 3, 5, 9, 19, 47, 87, 135, 481, 799, 101, 3409, 2241,
+	1, 3, 1, 13, 3, 25, 15, 27, 181, 967, 669, 2577, 7249,
+	1, 1, 7, 3, 31, 5, 103, 53, 1, 911, 1209, 3697, 6685,
+	1, 1, 3, 1, 5, 5, 49, 135, 281, 747, 761, 2973, 7963,
+	1, 3, 3, 5, 19, 61, 125, 199, 299, 515, 1365, 369, 7027,
+	1, 3, 1, 7, 5, 41, 63, 229, 283, 571, 147, 447, 657,
+	1, 3, 1, 11, 5, 15, 55, 7, 259, 61, 27, 1429, 5631,
+	1, 1, 5, 1, 3, 53, 51, 253, 155, 553, 1293, 3735, 6567,
+	1, 3, 5, 9, 5, 41, 21, 159, 101, 785, 1981, 3799, 7693,
+	1, 3, 7, 7, 9, 3, 95, 105, 129, 213, 1215, 1027, 5699,
+	1, 1, 3, 3, 29, 13, 9, 253, 449, 321, 341, 2879, 171,
+	1, 3, 7, 11, 21, 11, 75, 35, 43, 965, 675, 2217, 7175,
+	1, 1, 5, 15, 31, 5, 29, 137, 311, 751, 47, 1367, 5921,
+	1, 1, 3, 15, 17, 1, 45, 69, 55, 649, 835, 569, 7615,
+	1, 3, 1, 13, 31, 7, 23, 15, 391, 145, 1845, 1825, 1403,
+	1, 1, 3, 15, 5, 9, 79, 77, 105, 399, 1933, 2503, 4781,
+	1, 3, 1, 3, 17, 47, 19, 13, 107, 475, 759, 2933, 3761,
+	1, 1, 7, 11, 3, 7, 121, 209, 397, 877, 293, 847, 7039,
+	1, 1, 1, 15, 29, 45, 5, 109, 335, 461, 143, 931, 4045,
+	1, 3, 1, 7, 11, 57, 73, 89, 201, 173, 803, 3953, 5205,
+	1, 1, 5, 11, 11, 33, 37, 29, 263, 1019, 657, 1453, 7807,
+	1, 3, 3, 13, 31, 25, 37, 47, 261, 607, 1703, 2603, 417,
+	1, 1, 1, 1, 31, 61, 45, 115, 275, 239, 1989, 1897, 4329,
+	1, 3, 5, 3, 31, 3, 11, 173, 335, 579, 1193, 2219, 7875,
+	1, 1, 7, 9, 29, 45, 13, 67, 399, 177, 1293, 3865, 2225,
+	1, 1, 7, 11, 11, 51, 121, 227, 469, 905, 929, 2635, 4165,
+	1, 3, 7, 9, 13, 39, 55, 167, 23, 147, 1603, 2083, 4645,
+	1, 1, 3, 15, 27, 53, 11, 155, 157, 629, 259, 3009, 4605,
+	1, 3, 1, 7, 15, 47, 51, 1, 259, 603, 887, 2833, 6581,
+	1, 3, 5, 3, 1, 47, 91, 43, 361, 571, 29, 1453, 4269,
+	1, 1, 3, 9, 11, 51, 55, 23, 415, 277, 1423, 3475, 1527,
+	1, 1, 3, 11, 29, 49, 101, 75, 299, 709, 805, 4037, 4389,
+	1, 1, 7, 3, 23, 1, 37, 51, 379, 771, 1301, 3717, 6673,
+	1, 1, 5, 3, 23, 11, 125, 177, 375, 665, 951, 1577, 2603,
+	1, 1, 1, 1, 1, 5, 71, 255, 21, 459, 467, 2083, 5415,
+	1, 1, 5, 13, 23, 29, 109, 157, 363, 971, 549, 647, 1177,
+	1, 1, 3, 9, 7, 15, 101, 3, 365, 213, 745, 1155, 6099,
+	1, 3, 5, 15, 15, 19, 47, 179, 303, 521, 1279, 219, 2415,
+	1, 3, 3, 13, 27, 11, 83, 165, 369, 989, 261, 3933, 4809,
+	1, 1, 3, 11, 31, 59, 1, 185, 53, 703, 1471, 2935, 1107,
+	1, 3, 3, 7, 25, 3, 81, 27, 93, 521, 433, 2859, 5861,
+	1, 3, 3, 11, 29, 15, 49, 167, 315, 927, 543, 3473, 4307,
+	1, 3, 1, 3, 29, 33, 53, 15, 183, 691, 703, 1311, 3393,
+	1, 3, 5, 13, 23, 49, 3, 11, 1, 357, 1407, 415, 7211,
+	1, 3, 7, 15, 1, 25, 91, 113, 323, 371, 189, 925, 1181,
+	1, 3, 3, 3, 17, 59, 119, 199, 115, 223, 877, 2193, 193,
+	1, 1, 1, 5, 5, 35, 31, 59, 437, 411, 37, 2405, 3797,
+	1, 3, 1, 13, 9, 37, 1, 241, 59, 157, 1785, 1223, 563,
+	1, 3, 5, 13, 3, 21, 25, 95, 15, 745, 85, 701, 5361,
+	1, 3, 7, 1, 31, 33, 111, 195, 35, 913, 2013, 2951, 6611,
+	1, 3, 5, 1, 19, 3, 75, 119, 111, 409, 951, 1457, 4957,
+	1, 3, 1, 15, 19, 59, 3, 155, 237, 657, 1967, 3323, 6235,
+	1, 1, 5, 1, 3, 19, 45, 105, 377, 881, 167, 2255, 4483,
+	1, 1, 7, 7, 13, 13, 99, 89, 201, 279, 161, 2483, 6001,
+	1, 1, 7, 3, 13, 17, 97, 129, 137, 377, 1519, 183, 3725,
+	1, 1, 7, 9, 9, 5, 45, 135, 115, 181, 1685, 3505, 4387,
+	1, 1, 1, 1, 19, 35, 69, 113, 305, 419, 949, 2969, 247,
+	1, 1, 5, 13, 23, 61, 13, 139, 501, 811, 67, 1501, 6493,
+	1, 1, 3, 13, 15, 41, 27, 217, 293, 13, 145, 2631, 6991,
+	1, 3, 3, 13, 15, 37, 71, 123, 285, 49, 627, 1283, 5993,
+	1, 3, 3, 11, 9, 25, 11, 1, 203, 353, 1347, 1999, 2799,
+	1, 3, 5, 1, 7, 49, 101, 231, 499, 63, 1977, 2207, 7829,
+	1, 1, 7, 1, 17, 15, 115, 139, 381, 943, 623, 4037, 2971,
+	1, 1, 3, 5, 13, 55, 23, 87, 139, 795, 1669, 1375, 1185,
+	1, 3, 3, 5, 5, 45, 97, 253, 241, 333, 645, 555, 7867,
+	1, 3, 5, 1, 1, 1, 89, 27, 407, 509, 1433, 609, 2355,
+	1, 3, 7, 1, 27, 29, 5, 157, 495, 811, 1293, 1143, 827,
+	1, 1, 3, 3, 25, 49, 127, 111, 191, 3, 845, 1383, 2521,
+	1, 1, 5, 7, 5, 51, 101, 155, 237, 461, 831, 3091, 3851,
+	1, 3, 7, 1, 29, 35, 105, 91, 285, 705, 131, 395, 6011,
+	1, 3, 5, 3, 13, 21, 83, 173, 221, 827, 1775, 1931, 6727,
+	1, 1, 3, 5, 3, 25, 95, 115, 205, 569, 1447, 933, 6425,
+	1, 1, 7, 9, 31, 3, 17, 175, 145, 447, 1321, 1069, 6527,
+	1, 1, 3, 3, 23, 1, 79, 51, 421, 419, 873, 3939, 1801,
+	1, 1, 5, 1, 3, 39, 15, 85, 169, 669, 919, 397, 5579,
+	1, 3, 5, 1, 21, 61, 87, 217, 251, 619, 1091, 4009, 229,
+	1, 1, 1, 11, 23, 55, 85, 121, 363, 867, 315, 447, 3373,
+	1, 3, 3, 13, 29, 19, 89, 85, 137, 469, 1873, 2765, 3975,
+	1, 3, 7, 13, 19, 63, 61, 77, 67, 361, 11, 1787, 4703,
+	1, 1, 3, 11, 7, 15, 127, 105, 179, 857, 1671, 3647, 3389,
+	1, 1, 1, 7, 19, 21, 99, 161, 499, 519, 1287, 2973, 479,
+	1, 1, 3, 13, 29, 51, 95, 251, 55, 519, 1955, 2881, 5951,
+	1, 1, 3, 11, 23, 63, 121, 237, 175, 311, 701, 1539, 2383,
+	1, 1, 7, 5, 5, 45, 73, 97, 5, 153, 715, 2037, 3353,
+	1, 1, 1, 3, 13, 7, 67, 173, 425, 843, 1497, 2729, 5193,
+	1, 1, 7, 1, 23, 3, 119, 11, 77, 141, 1905, 2269, 4269,
+	1, 1, 7, 15, 1, 23, 79, 251, 439, 603, 405, 2449, 6383,
+	1, 3, 7, 11, 29, 27, 47, 255, 47, 661, 1967, 1007, 3689,
+	1, 3, 7, 5, 19, 39, 35, 115, 417, 373, 291, 329, 603,
+	1, 3, 1, 9, 11, 33, 27, 193, 207, 423, 1311, 1369, 7307,
+	1, 1, 3, 11, 9, 29, 83, 17, 497, 493, 329, 3141, 5935,
+	1, 3, 1, 5, 31, 51, 29, 171, 51, 493, 1621, 3501, 4091,
+	1, 1, 5, 9, 21, 43, 105, 207, 245, 363, 1191, 699, 1139,
+	1, 1, 3, 11, 19, 5, 81, 119, 247, 169, 1337, 45, 6565,
+	1, 3, 1, 11, 3, 51, 3, 101, 159, 11, 253, 299, 5043,
+	1, 3, 1, 5, 11, 53, 85, 39, 57, 645, 2007, 1039, 3627,
+	1, 3, 5, 3, 17, 61, 97, 165, 415, 357, 283, 601, 5505,
+	1, 3, 7, 3, 9, 51, 49, 85, 3, 227, 137, 309, 243,
+	1, 1, 5, 3, 11, 59, 11, 131, 409, 703, 455, 123, 6727,
+	1, 3, 7, 9, 25, 49, 21, 171, 287, 379, 667, 313, 713,
+	1, 1, 3, 9, 7, 35, 47, 3, 367, 581, 1627, 1665, 3905,
+	1, 3, 1, 1, 29, 57, 35, 55, 255, 653, 823, 2197, 6179,
+	1, 3, 7, 15, 17, 15, 117, 83, 359, 163, 115, 2999, 5373,
+	1, 1, 5, 3, 21, 61, 35, 97, 71, 687, 207, 2917, 1049,
+	1, 1, 1, 15, 13, 15, 125, 81, 263, 661, 417, 3243, 1669,
+	1, 1, 7, 3, 3, 19, 111, 193, 443, 339, 659, 1211, 1557,
+	1, 3, 1, 3, 27, 3, 3, 173, 391, 213, 803, 3281, 3207,
+	1, 1, 5, 15, 19, 1, 7, 211, 157, 603, 403, 1387, 1583,
+	1, 3, 5, 13, 17, 53, 125, 13, 339, 723, 521, 413, 5801, 10451,
+	1, 1, 3, 13, 29, 9, 99, 77, 141, 609, 1533, 983, 2039, 51,
+	1, 1, 3, 11, 21, 55, 5, 51, 423, 309, 525, 3715, 3025, 15055,
+	1, 1, 3, 7, 9, 21, 77, 171, 239, 341, 1653, 1093, 2273, 10723,
+	1, 1, 1, 15, 31, 15, 23, 35, 317, 869, 1917, 1415, 4313, 3687,
+	1, 1, 1, 5, 21, 25, 99, 167, 439, 453, 473, 431, 6665, 4989,
+	1, 1, 7, 9, 31, 47, 81, 83, 345, 43, 1363, 1885, 3155, 3185,
+	1, 3, 7, 1, 31, 17, 61, 185, 341, 129, 547, 717, 2071, 9991,
+	1, 3, 1, 13, 23, 61, 77, 217, 455, 77, 1263, 1601, 3501, 14953,
+	1, 1, 7, 7, 19, 19, 1, 229, 431, 943, 1069, 1949, 1289, 15729,
+	1, 1, 3, 5, 1, 35, 97, 251, 487, 459, 1265, 1739, 165, 10365,
+	1, 3, 5, 3, 11, 25, 79, 175, 383, 545, 187, 197, 4329, 3363,
+	1, 1, 3, 3, 29, 9, 63, 55, 175, 277, 431, 2549, 2629, 6409,
+	1, 1, 3, 15, 17, 21, 79, 139, 99, 135, 1763, 1805, 3471, 5439,
+	1, 1, 3, 9, 9, 15, 35, 119, 289, 835, 769, 3843, 4119, 4421,
+	1, 1, 1, 5, 19, 19, 67, 199, 307, 815, 1367, 1231, 3927, 6593,
+	1, 1, 3, 1, 29, 51, 121, 209, 431, 47, 1115, 907, 2535, 9755,
+	1, 1, 3, 5, 17, 1, 5, 119, 121, 223, 1719, 1291, 3947, 15891,
+	1, 3, 1, 15, 29, 25, 3, 131, 373, 307, 645, 3513, 1289, 1987,
+	1, 3, 3, 11, 29, 45, 105, 179, 331, 465, 891, 1315, 403, 3057,
+	1, 1, 5, 13, 17, 59, 77, 127, 485, 855, 1147, 3093, 891, 9869,
+	1, 1, 1, 7, 23, 27, 31, 203, 285, 463, 827, 685, 1349, 15051,
+	1, 1, 1, 5, 29, 5, 107, 195, 31, 425, 19, 2865, 3869, 11153,
+	1, 1, 7, 5, 7, 47, 1, 73, 307, 347, 393, 2205, 7709, 15121,
+	1, 1, 1, 13, 15, 61, 25, 131, 113, 369, 1995, 2527, 4475, 1745,
+	1, 1, 1, 1, 31, 63, 21, 253, 307, 281, 859, 3319, 6721, 2891,
+	1, 1, 3, 11, 1, 17, 5, 183, 301, 979, 651, 1685, 6343, 10067,
+	1, 1, 5, 15, 23, 45, 99, 145, 263, 507, 1381, 3425, 2215, 1815,
+	1, 3, 1, 5, 11, 63, 85, 203, 411, 881, 1369, 1237, 4657, 6541,
+	1, 3, 3, 13, 17, 53, 121, 201, 269, 983, 215, 3187, 7121, 6111,
+	1, 3, 5, 15, 15, 5, 13, 143, 3, 313, 1677, 1093, 3295, 3387,
+	1, 1, 3, 13, 3, 23, 73, 17, 257, 965, 239, 1271, 2803, 7327,
+	1, 3, 5, 13, 9, 57, 115, 37, 41, 467, 135, 1403, 3811, 4741,
+	1, 3, 7, 15, 9, 33, 39, 203, 351, 367, 1355, 1403, 3685, 4757,
+	1, 3, 5, 11, 31, 3, 113, 123, 203, 421, 1821, 3151, 2375, 4419,
+	1, 1, 1, 7, 21, 63, 99, 23, 133, 79, 991, 1755, 4989, 4709,
+	1, 3, 5, 1, 25, 63, 113, 239, 49, 443, 173, 1261, 3201, 10599,
+	1, 3, 3, 13, 3, 25, 101, 169, 23, 585, 327, 1327, 111, 10059,
+	1, 3, 3, 5, 19, 1, 33, 89, 437, 213, 1933, 1741, 2603, 5625,
+	1, 3, 1, 3, 15, 15, 25, 139, 73, 335, 237, 2461, 3101, 14951,
+	1, 3, 5, 1, 31, 15, 31, 187, 177, 659, 1339, 3767, 4975, 7123,
+	1, 3, 1, 3, 25, 19, 47, 89, 107, 107, 649, 683, 3123, 11085,
+	1, 3, 7, 9, 15, 21, 101, 25, 11, 625, 1555, 675, 3893, 5805,
+	1, 1, 1, 5, 7, 49, 123, 21, 439, 369, 207, 535, 4619, 14665,
+	1, 1, 5, 7, 1, 25, 103, 185, 99, 239, 1093, 1561, 6177, 4039,
+	1, 3, 7, 5, 29, 21, 43, 103, 343, 973, 1561, 2975, 7467, 7947,
+	1, 1, 7, 9, 19, 3, 13, 23, 461, 813, 1191, 985, 559, 3317,
+	1, 3, 5, 5, 27, 31, 79, 15, 365, 901, 1949, 117, 3619, 13311,
+	1, 3, 5, 7, 5, 33, 67, 199, 425, 189, 1691, 3099, 815, 1677,
+	1, 1, 7, 11, 13, 29, 73, 137, 265, 601, 445, 3893, 2511, 8047,
+	1, 1, 3, 1, 13, 5, 57, 101, 357, 391, 335, 601, 1359, 1065,
+	1, 1, 1, 1, 25, 57, 27, 115, 31, 873, 611, 2125, 447, 13585,
+	1, 3, 3, 13, 27, 17, 73, 11, 359, 33, 1153, 271, 4537, 15141,
+	1, 3, 7, 3, 11, 63, 103, 61, 59, 629, 1629, 3279, 3919, 3177,
+	1, 1, 5, 15, 3, 63, 85, 193, 381, 165, 175, 3247, 2501, 4209,
+	1, 1, 5, 15, 1, 33, 59, 219, 487, 193, 1557, 703, 2907, 7953,
+	1, 1, 7, 3, 9, 3, 105, 95, 389, 991, 21, 3841, 6983, 285,
+	1, 1, 1, 1, 1, 31, 25, 137, 117, 67, 1283, 1963, 6591, 15541,
+	1, 3, 5, 11, 7, 15, 127, 89, 453, 777, 1827, 2311, 7661, 11833,
+	1, 1, 7, 13, 19, 29, 79, 165, 223, 453, 2039, 3961, 6467, 5481,
+	1, 3, 3, 7, 17, 41, 43, 157, 323, 3, 1001, 2109, 4513, 12127,
+	1, 1, 5, 9, 31, 57, 3, 217, 113, 271, 1663, 1367, 6949, 8165,
+	1, 1, 7, 15, 27, 35, 81, 235, 61, 205, 525, 311, 6357, 2527,
+	1, 3, 1, 9, 19, 29, 71, 207, 321, 1011, 1615, 1333, 3459, 6681,
+	1, 3, 7, 7, 3, 57, 41, 19, 25, 397, 565, 1837, 7625, 11813,
+	1, 3, 3, 1, 27, 47, 31, 79, 441, 961, 1255, 423, 2405, 913,
+	1, 3, 3, 13, 3, 29, 69, 227, 85, 201, 395, 3199, 3869, 13099,
+	1, 3, 3, 7, 29, 61, 99, 7, 27, 227, 945, 873, 475, 4363,
+	1, 3, 5, 13, 19, 21, 57, 149, 217, 443, 565, 453, 5487, 10981,
+	1, 3, 3, 1, 9, 27, 47, 191, 35, 395, 1429, 4079, 6871, 8013,
+	1, 3, 5, 15, 5, 43, 9, 79, 279, 563, 1125, 985, 8117, 4099,
+	1, 3, 5, 1, 13, 41, 21, 117, 287, 667, 701, 1483, 8167, 13283,
+	1, 3, 1, 3, 15, 15, 59, 5, 383, 509, 1657, 3977, 7697, 10941,
+	1, 3, 1, 1, 17, 29, 19, 23, 377, 45, 981, 1631, 3557, 6749,
+	1, 3, 3, 9, 9, 51, 9, 193, 345, 361, 1679, 3333, 713, 5387,
+	1, 3, 5, 5, 17, 45, 97, 17, 385, 349, 105, 2245, 7295, 14393,
+	1, 3, 7, 3, 19, 51, 35, 99, 79, 301, 1563, 399, 5879, 14675,
+	1, 1, 7, 15, 13, 53, 55, 203, 417, 161, 2033, 1845, 6763, 3585,
+	1, 1, 3, 3, 7, 23, 11, 43, 241, 309, 1453, 3147, 2619, 3163,
+	1, 1, 1, 11, 17, 1, 17, 137, 443, 465, 993, 3217, 7879, 14607,
+	1, 1, 7, 13, 29, 49, 71, 217, 291, 793, 135, 21, 2503, 11091,
+	1, 3, 1, 11, 31, 51, 121, 227, 377, 157, 1457, 1317, 5625, 6217,
+	1, 1, 3, 7, 23, 61, 47, 93, 79, 617, 1805, 2403, 5513, 16335,
+	1, 3, 5, 11, 23, 25, 41, 11, 495, 587, 1223, 3107, 1469, 15223,
+	1, 3, 7, 7, 9, 1, 1, 49, 23, 723, 1761, 3717, 7375, 10875,
+	1, 3, 3, 11, 25, 37, 57, 63, 309, 603, 183, 285, 1663, 5627,
+	1, 3, 7, 11, 19, 25, 25, 201, 391, 257, 529, 1645, 1, 15111,
+	1, 3, 3, 9, 11, 43, 91, 65, 5, 959, 301, 1015, 6343, 3453,
+	1, 3, 3, 11, 17, 17, 103, 37, 77, 973, 575, 439, 49, 3639,
+	1, 1, 5, 7, 1, 15, 107, 237, 231, 967, 923, 1101, 6715, 1713,
+	1, 3, 1, 15, 9, 33, 29, 211, 245, 601, 1783, 887, 1209, 11785,
+	1, 3, 3, 7, 21, 43, 27, 89, 27, 141, 865, 367, 1379, 4063,
+	1, 3, 7, 7, 15, 17, 15, 15, 131, 649, 1955, 3289, 3983, 10689,
+	1, 3, 1, 5, 17, 7, 125, 69, 359, 981, 1345, 933, 5281, 7113,
+	1, 1, 5, 9, 17, 7, 41, 207, 497, 1015, 493, 891, 3563, 3541,
+	1, 3, 5, 11, 27, 3, 47, 31, 303, 1007, 2047, 2203, 6257, 8369,
+	1, 1, 1, 15, 25, 15, 89, 51, 217, 357, 1133, 1917, 213, 3365,
+	1, 1, 5, 13, 29, 23, 123, 207, 429, 805, 819, 2357, 6313, 11019,
+	1, 1, 3, 7, 19, 15, 41, 73, 279, 11, 1089, 3107, 7737, 15953,
+	1, 3, 5, 7, 7, 15, 41, 73, 493, 457, 1731, 1139, 2513, 12373,
+	1, 3, 5, 9, 17, 5, 55, 155, 173, 1005, 529, 3175, 7667, 4747,
+	1, 1, 7, 7, 5, 21, 105, 31, 205, 847, 1033, 3167, 2347, 8499,
+	1, 3, 5, 3, 11, 17, 59, 189, 179, 1007, 33, 3287, 4813, 8177,
+	1, 3, 3, 13, 27, 47, 47, 171, 413, 875, 1081, 1259, 7139, 8645,
+	1, 3, 5, 7, 25, 21, 51, 29, 361, 293, 51, 1119, 1453, 5283,
+	1, 3, 7, 7, 29, 55, 103, 199, 511, 341, 1957, 3987, 2855, 1279,
+	1, 1, 1, 9, 23, 51, 61, 63, 391, 37, 55, 3771, 6517, 15913,
+	1, 1, 1, 9, 3, 19, 13, 147, 453, 855, 1321, 189, 5043, 11215,
+	1, 3, 3, 13, 23, 3, 87, 155, 401, 981, 607, 3413, 995, 6473,
+	1, 3, 1, 9, 29, 47, 95, 123, 421, 353, 1867, 2609, 2569, 14083,
+	1, 1, 5, 13, 25, 39, 29, 111, 125, 545, 1493, 2371, 6361, 6307,
+	1, 3, 3, 11, 13, 31, 87, 75, 27, 393, 921, 3655, 3343, 16349,
+	1, 1, 5, 9, 19, 19, 7, 129, 223, 715, 433, 1627, 4463, 2951,
+	1, 1, 7, 1, 31, 13, 49, 33, 89, 43, 1529, 725, 3809, 3427,
+	1, 1, 7, 3, 1, 27, 45, 9, 309, 875, 659, 2661, 553, 7069,
+	1, 1, 7, 15, 13, 37, 61, 19, 125, 683, 1227, 2255, 1455, 9339,
+	1, 3, 5, 7, 19, 7, 71, 21, 465, 645, 1885, 873, 7405, 1913,
+	1, 3, 1, 11, 11, 35, 79, 61, 79, 57, 1603, 3719, 6323, 16371,
+	1, 1, 7, 1, 29, 57, 85, 21, 205, 37, 2045, 683, 4901, 8223,
+	1, 1, 5, 13, 31, 31, 65, 131, 259, 535, 967, 3943, 2605, 2089,
+	1, 1, 7, 9, 27, 61, 39, 243, 207, 41, 1909, 3279, 1331, 4635,
+	1, 3, 3, 5, 11, 63, 105, 19, 169, 95, 773, 3175, 1869, 1797,
+	1, 3, 3, 15, 13, 33, 107, 197, 153, 795, 1477, 105, 4965, 991,
+	1, 3, 7, 11, 11, 37, 23, 149, 197, 3, 1035, 3857, 553, 1059,
+	1, 3, 1, 3, 17, 29, 89, 189, 193, 59, 1477, 3517, 2565, 7739,
+	1, 1, 1, 9, 23, 3, 25, 163, 469, 305, 1791, 3393, 6141, 8119,
+	1, 3, 5, 7, 7, 41, 19, 101, 179, 487, 1071, 2761, 8043, 5103,
+	1, 1, 7, 9, 1, 21, 101, 103, 349, 85, 1841, 1033, 4473, 3563,
+	1, 1, 3, 13, 23, 61, 39, 27, 479, 13, 45, 1371, 7897, 10637,
+	1, 1, 5, 9, 17, 61, 71, 55, 355, 99, 1695, 3053, 839, 959,
+	1, 1, 3, 1, 7, 27, 87, 221, 327, 241, 461, 3177, 5933, 8299,
+	1, 3, 7, 9, 5, 41, 111, 245, 447, 263, 1363, 1767, 6331, 3355,
+	1, 3, 3, 13, 15, 11, 15, 169, 429, 149, 1965, 2477, 7733, 2499,
+	1, 1, 5, 15, 15, 47, 25, 33, 469, 701, 773, 2747, 1533, 14633,
+	1, 3, 1, 5, 19, 57, 37, 75, 423, 11, 685, 2487, 1779, 8797,
+	1, 3, 1, 5, 19, 41, 67, 99, 333, 991, 953, 3221, 939, 4197,
+	1, 3, 1, 15, 11, 39, 25, 1, 159, 679, 465, 1611, 5799, 2537,
+	1, 1, 5, 11, 5, 37, 37, 7, 101, 703, 235, 23, 2209, 12799,
+	1, 1, 7, 3, 11, 23, 71, 215, 45, 269, 1539, 3625, 5773, 6889,
+	1, 3, 5, 15, 27, 33, 105, 109, 205, 653, 821, 435, 1087, 2495,
+	1, 1, 3, 5, 11, 39, 53, 213, 41, 385, 1425, 25, 5553, 12523,
+	1, 3, 5, 15, 29, 49, 13, 253, 505, 407, 985, 2569, 6727, 4761,
+	1, 1, 1, 3, 29, 17, 69, 47, 25, 819, 1145, 2479, 1183, 3343,
+	1, 3, 1, 15, 25, 61, 43, 55, 279, 579, 361, 355, 6101, 3143,
+	1, 3, 5, 11, 3, 59, 125, 101, 451, 495, 1711, 3443, 3625, 15579,
+	1, 3, 1, 11, 25, 61, 49, 219, 23, 795, 481, 3609, 3691, 15419,
+	1, 3, 7, 5, 9, 59, 49, 233, 345, 143, 181, 3587, 3041, 1219,
+	1, 3, 7, 13, 9, 31, 39, 137, 261, 919, 1367, 3145, 4659, 5875,
+	1, 1, 3, 3, 27, 43, 95, 65, 301, 915, 31, 451, 7743, 7277,
+	1, 3, 1, 5, 23, 37, 53, 31, 203, 453, 71, 1585, 6011, 16369,
+	1, 1, 5, 1, 15, 47, 91, 227, 297, 45, 1415, 3647, 7811, 14015,
+	1, 1, 1, 1, 29, 27, 93, 121, 169, 69, 1361, 2907, 1867, 7017,
+	1, 3, 1, 7, 23, 53, 77, 41, 25, 873, 1333, 3889, 3239, 1771,
+	1, 1, 1, 7, 31, 27, 87, 81, 167, 343, 1981, 2499, 7749, 15747,
+	1, 3, 5, 13, 1, 17, 97, 37, 81, 645, 1167, 3547, 7769, 10731,
+	1, 1, 7, 5, 9, 17, 31, 55, 151, 463, 1041, 2303, 4015, 3737,
+	1, 1, 3, 11, 31, 9, 81, 213, 95, 215, 2031, 2129, 4299, 3021,
+	1, 1, 1, 3, 25, 25, 115, 229, 101, 441, 783, 1729, 7905, 2375,
+	1, 1, 5, 9, 3, 19, 73, 35, 379, 493, 1333, 1647, 13, 197,
+	1, 1, 7, 9, 3, 55, 99, 43, 281, 9, 73, 2477, 8183, 11055,
+	1, 3, 7, 13, 25, 19, 27, 195, 469, 175, 355, 1861, 7255, 15377,
+	1, 1, 3, 11, 15, 19, 115, 31, 413, 835, 697, 879, 6515, 13465,
+	1, 3, 3, 15, 3, 61, 105, 201, 151, 739, 49, 3963, 2573, 3303,
+	1, 3, 5, 7, 23, 5, 11, 215, 19, 591, 509, 2887, 1631, 4391,
+	1, 3, 3, 3, 25, 1, 109, 5, 363, 545, 1745, 503, 827, 4677,
+	1, 1, 3, 15, 1, 45, 121, 141, 497, 745, 1825, 2041, 2561, 8153,
+	1, 3, 1, 11, 29, 7, 71, 241, 7, 39, 1379, 2479, 7483, 7195,
+	1, 1, 7, 11, 3, 27, 39, 97, 339, 217, 1409, 1569, 4761, 1567,
+	1, 1, 5, 15, 11, 53, 87, 213, 297, 923, 393, 717, 3297, 16123,
+	1, 1, 1, 11, 27, 41, 121, 49, 225, 379, 1305, 319, 2461, 5445,
+	1, 1, 5, 5, 25, 3, 121, 23, 47, 843, 1679, 1427, 6393, 4199,
+	1, 1, 5, 13, 17, 3, 17, 25, 161, 487, 121, 361, 1375, 10745,
+	1, 1, 7, 3, 3, 37, 7, 245, 107, 107, 745, 2415, 2131, 11419,
+	1, 1, 5, 3, 3, 23, 67, 91, 281, 387, 465, 905, 883, 9775,
+	1, 3, 7, 15, 25, 55, 123, 49, 23, 983, 1903, 2589, 2073, 7823,
+	1, 1, 5, 11, 25, 17, 63, 229, 267, 175, 1759, 1947, 479, 11089,
+	1, 3, 7, 3, 11, 37, 83, 95, 415, 1003, 1175, 2361, 2117, 9809,
+	1, 3, 1, 9, 5, 39, 51, 129, 249, 161, 1981, 2755, 8057, 13641,
+	1, 1, 7, 1, 15, 47, 9, 197, 199, 549, 1091, 2853, 2331, 4535,
+	1, 3, 3, 13, 15, 21, 23, 111, 463, 719, 1667, 377, 5039, 10723,
+	1, 1, 3, 7, 23, 47, 39, 47, 307, 949, 1651, 2525, 5835, 1425,
+	1, 3, 3, 9, 23, 47, 111, 39, 251, 1001, 179, 3985, 535, 15435,
+	1, 1, 3, 13, 5, 45, 51, 123, 205, 651, 1583, 1691, 1631, 11975,
+	1, 1, 7, 9, 1, 29, 59, 27, 389, 497, 1459, 1633, 521, 14037,
+	1, 1, 3, 3, 3, 23, 35, 247, 371, 729, 931, 681, 1777, 8353,
+	1, 3, 3, 1, 19, 15, 17, 191, 495, 643, 319, 37, 5691, 7049,
+	1, 3, 5, 11, 5, 31, 123, 243, 335, 573, 113, 209, 4825, 7783,
+	1, 3, 7, 7, 29, 19, 25, 191, 89, 515, 55, 3013, 4523, 12913,
+	1, 1, 3, 3, 15, 3, 35, 37, 339, 7, 697, 359, 4553, 1431,
+	1, 3, 1, 1, 9, 15, 33, 77, 161, 13, 255, 1187, 6587, 11715,
+	1, 3, 7, 7, 25, 57, 61, 171, 231, 43, 1219, 903, 5623, 4781,
+	1, 1, 5, 15, 29, 47, 117, 23, 213, 907, 1423, 369, 4529, 9651,
+	1, 1, 5, 7, 15, 55, 105, 249, 401, 37, 1885, 3779, 3441, 9057,
+	1, 1, 5, 3, 3, 27, 49, 89, 335, 561, 1235, 3251, 2731, 12711,
+	1, 1, 1, 15, 29, 49, 37, 173, 25, 743, 1321, 821, 5899, 9213,
+	1, 1, 7, 3, 1, 41, 61, 209, 275, 925, 521, 3029, 1569, 9277,
+	1, 3, 5, 13, 17, 1, 11, 171, 441, 119, 1589, 299, 157, 11439,
+	1, 1, 5, 9, 13, 33, 27, 77, 363, 939, 1103, 2135, 1759, 5429,
+	1, 3, 7, 1, 17, 39, 49, 201, 49, 803, 2003, 1193, 7415, 13847,
+	1, 1, 5, 5, 17, 49, 39, 19, 311, 801, 1441, 3263, 7973, 14181,
+	1, 1, 3, 9, 9, 27, 59, 89, 81, 473, 1369, 3121, 7929, 10905,
+	1, 3, 3, 5, 17, 35, 35, 239, 379, 431, 501, 3561, 2059, 9679,
+	1, 3, 5, 15, 25, 29, 113, 179, 269, 891, 301, 2017, 7513, 9379,
+	1, 3, 1, 11, 17, 35, 49, 149, 135, 661, 1691, 3169, 3765, 9003,
+	1, 3, 7, 15, 5, 21, 53, 241, 475, 271, 683, 2351, 2181, 6333,
+	1, 1, 7, 13, 25, 33, 71, 153, 221, 507, 2017, 2401, 7545, 8489,
+	1, 1, 7, 5, 1, 49, 87, 1, 179, 331, 1597, 3713, 809, 11109,
+	1, 3, 1, 5, 5, 61, 93, 39, 479, 977, 1099, 1291, 7049, 2797,
+	1, 3, 1, 13, 19, 41, 57, 77, 5, 117, 125, 115, 3969, 1345,
+	1, 1, 1, 9, 15, 9, 57, 7, 219, 41, 767, 23, 5771, 14175,
+	1, 3, 7, 9, 17, 61, 1, 59, 227, 349, 63, 189, 3871, 7919,
+	1, 3, 5, 5, 9, 29, 33, 203, 413, 701, 1129, 2103, 1889, 8377,
+	1, 1, 3, 1, 9, 17, 69, 115, 123, 1001, 1, 2893, 3957, 8593,
+	1, 1, 3, 1, 31, 41, 83, 91, 113, 195, 1121, 2665, 6815, 1189,
+	1, 1, 1, 13, 3, 59, 13, 123, 95, 103, 1689, 2809, 5049, 4055,
+	1, 1, 1, 15, 21, 41, 11, 167, 375, 589, 207, 1631, 1597, 8091,
+	1, 3, 5, 5, 1, 33, 57, 89, 157, 921, 1353, 2777, 461, 14567,
+	1, 1, 5, 1, 25, 5, 51, 247, 1, 577, 463, 3741, 303, 16059,
+	1, 1, 7, 5, 13, 7, 17, 87, 51, 987, 835, 93, 5203, 3973,
+	1, 1, 7, 7, 3, 27, 7, 1, 135, 171, 231, 3349, 4459, 2925,
+	1, 1, 5, 5, 9, 51, 71, 153, 115, 315, 265, 2207, 4127, 12631,
+	1, 1, 3, 15, 23, 59, 35, 121, 425, 921, 1255, 2123, 5811, 15937,
+	1, 3, 7, 7, 11, 21, 45, 57, 269, 395, 555, 783, 6677, 2889,
+	1, 3, 5, 7, 31, 19, 73, 35, 465, 349, 1429, 863, 4707, 6121,
+	1, 3, 3, 9, 25, 27, 119, 159, 195, 949, 19, 73, 4511, 15711,
+	1, 3, 3, 7, 9, 59, 47, 57, 91, 749, 1579, 1297, 2445, 5167,
+	1, 3, 3, 3, 31, 57, 19, 203, 61, 927, 1477, 2863, 1305, 11673,
+	1, 3, 7, 11, 29, 13, 3, 111, 351, 79, 1863, 2213, 3273, 7049,
+	1, 3, 3, 9, 7, 23, 47, 237, 121, 877, 441, 119, 2723, 3989,
+	1, 3, 3, 11, 17, 23, 63, 177, 231, 363, 1451, 33, 2169, 7251,
+	1, 1, 5, 11, 31, 41, 93, 229, 39, 1009, 1061, 433, 2393, 15401,
+	1, 1, 5, 15, 31, 37, 25, 135, 135, 897, 33, 3713, 7663, 8079,
+	1, 1, 5, 7, 17, 49, 43, 89, 411, 731, 1431, 3893, 1635, 7063,
+	1, 1, 1, 13, 29, 27, 5, 77, 283, 913, 789, 817, 3309, 475,
+	1, 1, 3, 1, 19, 21, 67, 77, 423, 551, 5, 1057, 5469, 7859,
+	1, 1, 5, 1, 1, 21, 99, 237, 215, 759, 1505, 1983, 1517, 8923,
+	1, 3, 5, 7, 19, 61, 73, 215, 165, 127, 205, 259, 7755, 15395,
+	1, 1, 5, 9, 15, 23, 17, 111, 471, 751, 1923, 775, 6901, 13095,
+	1, 1, 7, 1, 25, 5, 63, 141, 461, 687, 1589, 1559, 7719, 11349,
+	1, 1, 1, 3, 11, 63, 11, 27, 253, 439, 297, 1315, 829, 3765,
+	1, 3, 1, 1, 9, 47, 127, 179, 173, 809, 241, 35, 7355, 5049,
+	1, 3, 1, 11, 19, 63, 93, 1, 205, 977, 303, 3409, 6529, 10927,
+	1, 3, 7, 9, 31, 63, 41, 79, 477, 91, 1801, 3487, 6885, 13341,
+	1, 1, 3, 7, 15, 59, 9, 101, 459, 247, 549, 2855, 5765, 7785,
+	1, 1, 7, 3, 13, 59, 71, 123, 93, 517, 1453, 2389, 4429, 5053,
+	1, 1, 5, 3, 19, 21, 77, 53, 81, 879, 1653, 1637, 3667, 2623,
+	1, 1, 1, 15, 17, 57, 65, 53, 407, 765, 417, 497, 5009, 2175,
+	1, 3, 3, 7, 31, 13, 5, 203, 263, 17, 119, 1607, 6773, 11195,
+	1, 3, 3, 13, 19, 13, 13, 147, 93, 735, 689, 781, 655, 6853,
+	1, 1, 1, 1, 1, 25, 63, 159, 493, 987, 71, 1249, 5859, 11717,
+	1, 1, 1, 15, 13, 23, 61, 61, 5, 947, 1853, 3331, 467, 8081,
+	1, 1, 3, 9, 19, 61, 65, 189, 95, 309, 283, 1725, 5683, 15463,
+	1, 1, 7, 5, 9, 33, 35, 75, 475, 831, 1445, 1485, 5047, 9631,
+	1, 1, 3, 15, 11, 23, 59, 87, 433, 221, 685, 3113, 4095, 13819,
+	1, 1, 7, 15, 25, 29, 67, 17, 349, 353, 1321, 563, 57, 533,
+	1, 3, 3, 3, 5, 43, 109, 217, 15, 185, 1895, 1015, 1831, 10623,
+	1, 1, 7, 1, 1, 47, 81, 185, 59, 691, 191, 3709, 1535, 13347,
+	1, 1, 5, 1, 23, 57, 83, 217, 457, 771, 1877, 2789, 8143, 4797,
+	1, 1, 3, 7, 23, 35, 79, 49, 227, 205, 1523, 3873, 4843, 10505,
+	1, 1, 1, 1, 17, 43, 121, 95, 205, 35, 189, 2061, 1693, 13273,
+	1, 1, 1, 15, 31, 49, 83, 249, 433, 497, 1949, 1845, 5215, 5971,
+	1, 3, 1, 1, 21, 53, 73, 211, 265, 929, 923, 279, 3621, 9469,
+	1, 3, 7, 7, 1, 57, 13, 45, 467, 705, 371, 1345, 1647, 3411,
+	1, 3, 1, 11, 27, 29, 117, 163, 143, 669, 489, 3913, 7891, 9031,
+	1, 3, 7, 15, 27, 15, 77, 217, 107, 839, 1517, 1543, 357, 10365,
+	1, 1, 1, 5, 31, 17, 107, 245, 345, 939, 1453, 3645, 6865, 16173,
+	1, 3, 5, 5, 9, 61, 43, 97, 453, 917, 945, 2143, 5473, 5611,
+	1, 1, 5, 11, 3, 33, 71, 97, 137, 549, 1605, 3839, 4883, 2677,
+	1, 3, 1, 11, 29, 23, 85, 47, 225, 633, 1613, 1297, 1415, 15813,
+	1, 1, 3, 3, 9, 19, 57, 107, 79, 449, 1951, 753, 6317, 10377,
+	1, 1, 1, 5, 21, 3, 39, 187, 299, 517, 1313, 741, 7259, 4197,
+	1, 1, 5, 13, 1, 39, 39, 41, 381, 123, 1257, 3185, 493, 3723,
+	1, 3, 7, 7, 3, 37, 15, 161, 129, 169, 555, 3605, 4287, 15831,
+	1, 3, 7, 15, 15, 23, 81, 163, 257, 791, 505, 1903, 2703, 11919,
+	1, 3, 7, 7, 27, 63, 17, 147, 111, 851, 1533, 1365, 5359, 3315,
+	1, 3, 7, 1, 15, 5, 61, 143, 385, 261, 1019, 1705, 1737, 14485,
+	1, 3, 5, 5, 25, 17, 49, 229, 431, 567, 1613, 3431, 2139, 2981,
+	1, 3, 5, 11, 17, 57, 71, 241, 31, 1007, 1695, 2965, 149, 14125,
+	1, 1, 3, 11, 7, 49, 39, 101, 5, 501, 1491, 3061, 225, 12255,
+	1, 3, 5, 7, 17, 35, 37, 97, 415, 15, 1349, 997, 2949, 4511,
+	1, 3, 1, 5, 25, 35, 99, 183, 161, 59, 1363, 515, 3767, 3641,
+	1, 1, 7, 15, 7, 15, 127, 137, 281, 67, 139, 2315, 3517, 13371,
+	1, 1, 5, 15, 23, 49, 19, 79, 425, 805, 1035, 429, 7707, 14195,
+	1, 3, 5, 3, 21, 25, 123, 11, 425, 475, 961, 2995, 7405, 5449,
+	1, 1, 7, 1, 21, 1, 75, 231, 451, 595, 719, 2369, 5907, 1227,
+	1, 1, 1, 9, 21, 57, 45, 255, 19, 79, 481, 3363, 3451, 8399,
+	1, 1, 7, 13, 31, 49, 95, 69, 483, 427, 37, 4047, 7057, 9111,
+	1, 3, 3, 11, 3, 61, 87, 79, 499, 91, 771, 1987, 2017, 3381,
+	1, 3, 1, 7, 5, 57, 1, 121, 155, 225, 501, 477, 6555, 9863,
+	1, 3, 7, 11, 27, 49, 83, 213, 61, 283, 1599, 3205, 2525, 8553,
+	1, 1, 1, 9, 9, 49, 3, 51, 141, 33, 301, 2167, 587, 15067,
+	1, 1, 1, 11, 7, 55, 99, 81, 191, 553, 953, 3753, 6731, 1093,
+	1, 1, 3, 3, 11, 59, 57, 235, 297, 197, 853, 1411, 3799, 7527,
+	1, 3, 5, 3, 7, 7, 5, 201, 393, 95, 91, 3273, 6285, 10661,
+	1, 1, 5, 7, 17, 57, 87, 3, 413, 915, 659, 369, 3593, 14429,
+	1, 3, 7, 1, 31, 31, 45, 115, 417, 427, 745, 4087, 953, 1119,
+	1, 3, 7, 3, 29, 43, 45, 221, 41, 641, 451, 173, 2999, 12103,
+	1, 1, 3, 11, 25, 57, 117, 201, 135, 787, 1525, 3879, 3247, 8907,
+	1, 1, 7, 11, 3, 35, 69, 157, 331, 615, 573, 2169, 3575, 289,
+	1, 3, 3, 13, 15, 51, 67, 127, 265, 495, 103, 3145, 2685, 15919,
+	1, 3, 5, 11, 31, 27, 65, 57, 153, 465, 1163, 467, 4103, 4713,
+	1, 3, 7, 3, 23, 31, 9, 51, 239, 417, 1597, 229, 2865, 15199,
+	1, 3, 5, 3, 11, 45, 123, 217, 31, 765, 1009, 2001, 3645, 9407,
+	1, 3, 3, 9, 5, 23, 117, 83, 237, 1017, 251, 1187, 2631, 5151,
+	1, 1, 1, 7, 23, 55, 97, 141, 501, 305, 467, 4061, 2369, 15973,
+	1, 1, 7, 5, 31, 51, 125, 191, 219, 495, 37, 3337, 813, 241,
+	1, 3, 1, 1, 11, 39, 93, 109, 285, 147, 1297, 737, 4051, 7223,
+	1, 3, 1, 15, 13, 17, 57, 171, 463, 163, 609, 1681, 7583, 9231,
+	1, 3, 1, 1, 23, 5, 51, 5, 205, 415, 419, 989, 4239, 10943,
+	1, 1, 3, 15, 3, 13, 65, 145, 387, 59, 395, 1067, 4143, 5649,
+	1, 3, 1, 13, 9, 59, 121, 127, 95, 71, 1541, 1423, 1753, 8041,
+	1, 1, 3, 15, 7, 5, 69, 167, 181, 991, 1189, 4017, 5935, 6669,
+	1, 3, 5, 7, 23, 41, 53, 21, 47, 261, 1231, 2011, 133, 2247,
+	1, 1, 1, 5, 17, 47, 77, 19, 331, 609, 1893, 3965, 3123, 9093,
+	1, 3, 1, 3, 9, 39, 103, 231, 249, 75, 373, 107, 1823, 10801,
+	1, 3, 3, 7, 1, 51, 35, 111, 137, 879, 1221, 225, 4285, 2287,
+	1, 1, 7, 9, 23, 17, 75, 245, 409, 163, 395, 3731, 7111, 6845,
+	1, 1, 3, 13, 29, 47, 75, 153, 497, 621, 1691, 3187, 2125, 10533,
+	1, 1, 7, 7, 9, 7, 55, 159, 255, 417, 1335, 643, 3843, 3733,
+	1, 3, 3, 1, 21, 41, 7, 21, 5, 679, 1655, 95, 5699, 5785,
+	1, 1, 1, 13, 19, 7, 85, 7, 195, 357, 1097, 2893, 2913, 9635,
+	1, 1, 5, 9, 25, 33, 41, 155, 39, 655, 1993, 3117, 3639, 7977,
+	1, 1, 1, 13, 3, 63, 121, 247, 151, 673, 609, 285, 2299, 7663,
+	1, 3, 7, 11, 17, 13, 49, 253, 245, 21, 273, 993, 911, 863,
+	1, 1, 5, 5, 23, 1, 121, 95, 225, 9, 1237, 1183, 6461, 559,
+	1, 3, 7, 13, 3, 7, 121, 151, 233, 561, 281, 3583, 897, 1767,
+	1, 1, 7, 7, 9, 47, 107, 41, 25, 569, 1697, 2299, 6231, 12209,
+	1, 3, 7, 7, 27, 43, 59, 37, 31, 51, 503, 149, 4043, 11847,
+	1, 3, 3, 11, 5, 1, 119, 181, 47, 641, 685, 4017, 637, 16251,
+	1, 3, 3, 7, 11, 1, 101, 7, 239, 747, 307, 1721, 5979, 4367,
+	1, 3, 5, 7, 1, 63, 19, 151, 469, 333, 1587, 2453, 897, 4711,
+	1, 3, 1, 5, 11, 61, 21, 253, 91, 993, 1347, 1993, 5607, 13031,
+	1, 3, 5, 5, 1, 39, 65, 71, 189, 389, 1437, 1055, 6439, 3989,
+	1, 1, 3, 3, 19, 15, 93, 3, 339, 165, 1675, 3953, 2145, 12113,
+	1, 1, 3, 13, 13, 45, 5, 175, 211, 993, 705, 2761, 3023, 13633,
+	1, 1, 3, 1, 19, 39, 121, 29, 287, 87, 281, 3491, 7107, 13007,
+	1, 1, 7, 1, 29, 49, 103, 187, 39, 923, 51, 1533, 3249, 4399,
+	1, 1, 5, 5, 5, 43, 25, 107, 453, 955, 115, 57, 4589, 14573,
+	1, 1, 3, 5, 21, 45, 103, 99, 183, 987, 1207, 1697, 8033, 13703,
+	1, 1, 5, 7, 11, 23, 9, 17, 261, 749, 1957, 935, 6283, 8625,
+	1, 1, 1, 9, 9, 51, 69, 225, 265, 323, 1161, 2993, 7305, 2249,
+	1, 3, 1, 9, 23, 19, 57, 205, 503, 489, 1499, 3277, 817, 11931,
+	1, 3, 3, 5, 1, 7, 49, 1, 313, 123, 643, 2027, 1469, 3585,
+	1, 3, 7, 11, 27, 47, 95, 111, 27, 213, 465, 3693, 3661, 7531,
+	1, 1, 7, 9, 3, 37, 115, 189, 31, 613, 1393, 1229, 4767, 12425,
+	1, 1, 3, 3, 25, 17, 99, 47, 161, 931, 959, 1293, 7095, 8325,
+	1, 1, 1, 7, 23, 9, 11, 51, 205, 419, 479, 1497, 2493, 13921,
+	1, 3, 1, 9, 17, 29, 51, 79, 159, 435, 477, 413, 3815, 5589,
+	1, 3, 7, 5, 7, 23, 99, 43, 169, 665, 403, 1163, 4337, 1335,
+	1, 3, 1, 5, 25, 27, 125, 249, 421, 267, 1259, 4089, 59, 9377,
+	1, 3, 3, 1, 27, 37, 91, 17, 123, 597, 1749, 3449, 6503, 11043,
+	1, 3, 7, 7, 23, 41, 19, 245, 109, 569, 547, 1917, 7943, 2697,
+	1, 3, 7, 7, 9, 1, 123, 105, 329, 435, 2013, 2745, 347, 11045,
+	1, 1, 1, 13, 29, 53, 51, 67, 105, 89, 1887, 3543, 963, 8159,
+	1, 1, 5, 3, 5, 27, 41, 67, 67, 883, 973, 1785, 901, 14969,
+	1, 3, 3, 13, 17, 11, 117, 115, 163, 939, 79, 641, 4365, 2267,
+	1, 1, 3, 3, 9, 5, 41, 123, 149, 9, 1533, 3939, 5995, 12701,
+	1, 1, 1, 15, 31, 1, 101, 229, 191, 965, 61, 2671, 4177, 15779,
+	1, 1, 5, 15, 1, 25, 49, 185, 33, 697, 1043, 2639, 7819, 3171,
+	1, 3, 5, 13, 19, 9, 111, 49, 47, 847, 1865, 717, 5287, 13417,
+	1, 3, 7, 11, 5, 61, 63, 111, 171, 735, 2003, 73, 5701, 647,
+	1, 3, 1, 11, 1, 49, 121, 79, 431, 671, 1241, 1161, 2057, 263,
+	1, 3, 3, 1, 1, 23, 75, 15, 117, 641, 313, 1525, 2041, 1409,
+	1, 3, 5, 11, 15, 57, 13, 67, 139, 131, 1339, 2419, 7945, 11877,
+	1, 3, 1, 1, 19, 39, 97, 83, 297, 595, 1611, 5, 4753, 3435,
+	1, 3, 1, 9, 7, 49, 125, 101, 383, 717, 63, 2295, 3873, 13461,
+	1, 1, 3, 3, 15, 29, 89, 77, 269, 689, 229, 1207, 7311, 8663,
+	1, 1, 1, 1, 1, 61, 25, 255, 203, 233, 271, 987, 2277, 8735,
+	1, 1, 5, 7, 21, 27, 63, 79, 337, 133, 1453, 3633, 6157, 15875,
+	1, 3, 1, 7, 7, 55, 31, 81, 203, 709, 1743, 1677, 4247, 11411,
+	1, 1, 3, 3, 29, 51, 37, 17, 487, 325, 1393, 1433, 3467, 2851,
+	1, 1, 7, 9, 3, 41, 99, 177, 241, 869, 739, 2729, 4585, 14801,
+	1, 1, 3, 1, 9, 43, 97, 65, 99, 295, 1693, 2083, 3241, 4073,
+	1, 1, 1, 9, 5, 39, 67, 119, 235, 543, 795, 2773, 3195, 6273,
+	1, 1, 5, 5, 21, 41, 89, 1, 85, 81, 57, 2951, 1531, 10101,
+	1, 1, 1, 7, 3, 35, 127, 69, 39, 265, 1643, 2973, 267, 12365,
+	1, 3, 1, 1, 21, 57, 99, 205, 119, 477, 1771, 1989, 2761, 12573,
+	1, 1, 3, 13, 1, 59, 93, 125, 279, 935, 1877, 2061, 4845, 7835,
+	1, 1, 7, 9, 7, 45, 69, 99, 273, 35, 1579, 2137, 7175, 6999,
+	1, 1, 7, 7, 29, 21, 127, 91, 9, 383, 787, 1783, 601, 5047,
+	1, 1, 7, 13, 7, 29, 35, 219, 43, 581, 2043, 2211, 6169, 12173,
+	1, 3, 5, 13, 29, 29, 39, 63, 411, 645, 415, 2383, 1989, 11411,
+	1, 1, 7, 9, 15, 9, 87, 95, 321, 709, 543, 3831, 2453, 4167,
+	1, 3, 1, 5, 31, 25, 5, 85, 239, 487, 1613, 3937, 4661, 3535,
+	1, 3, 5, 11, 27, 41, 3, 201, 39, 91, 1997, 237, 5639, 14703,
+	1, 1, 7, 3, 27, 49, 87, 71, 473, 247, 1007, 47, 475, 5413,
+	1, 3, 7, 15, 9, 57, 81, 149, 287, 333, 1911, 3417, 1081, 8995,
+	1, 1, 5, 1, 3, 63, 43, 151, 97, 431, 961, 1019, 5153, 2407,
+	1, 1, 5, 5, 27, 21, 127, 161, 507, 311, 129, 3489, 1133, 3241,
+	1, 3, 7, 15, 21, 33, 117, 83, 497, 667, 1399, 931, 1695, 8171,
+	1, 1, 1, 13, 3, 39, 53, 27, 193, 993, 671, 1871, 7579, 11457,
+	1, 1, 5, 11, 7, 39, 81, 107, 195, 387, 849, 395, 1317, 6487,
+	1, 3, 3, 3, 3, 15, 45, 127, 279, 111, 331, 357, 4637, 4697,
+	1, 1, 3, 9, 21, 49, 47, 97, 61, 101, 181, 1867, 1201, 14099,
+	1, 1, 5, 11, 25, 19, 51, 51, 101, 451, 545, 101, 7497, 9141,
+	1, 1, 1, 3, 13, 53, 119, 81, 377, 245, 765, 251, 3757, 16045,
+	1, 1, 1, 3, 5, 61, 65, 37, 331, 925, 1439, 3219, 2843, 11397,
+	1, 3, 5, 9, 23, 31, 95, 155, 83, 641, 1129, 135, 477, 1623,
+	1, 1, 3, 9, 9, 61, 93, 11, 331, 585, 799, 1417, 1533, 463,
+	1, 1, 7, 7, 21, 51, 61, 29, 467, 935, 11, 3357, 1087, 12337,
+	1, 3, 3, 11, 1, 39, 103, 153, 351, 893, 1823, 835, 2149, 4203,
+	1, 1, 1, 9, 31, 13, 61, 235, 369, 359, 835, 2067, 2697, 15289,
+	1, 1, 7, 1, 15, 1, 107, 27, 201, 451, 1521, 313, 3195, 3847,
+	1, 1, 5, 13, 1, 27, 63, 137, 355, 489, 2039, 1015, 2519, 13797,
+	1, 1, 7, 9, 29, 33, 23, 197, 49, 555, 1087, 3447, 7299, 15513,
+	1, 3, 5, 11, 7, 37, 55, 63, 443, 573, 1715, 631, 3405, 6155,
+	1, 3, 3, 3, 31, 35, 51, 167, 225, 617, 2007, 2555, 6819, 12709,
+	1, 1, 1, 13, 15, 5, 73, 85, 109, 43, 1067, 3941, 1125, 10269,
+	1, 1, 7, 11, 17, 3, 127, 145, 279, 19, 1007, 3287, 4751, 12507,
+	1, 3, 7, 3, 19, 1, 117, 111, 193, 435, 47, 1801, 529, 8547,
+	1, 3, 3, 13, 1, 19, 101, 19, 469, 187, 207, 1243, 8153, 3273,
+	1, 3, 1, 5, 11, 51, 69, 189, 453, 775, 241, 3331, 4067, 14759,
+	1, 1, 1, 1, 23, 55, 113, 133, 497, 731, 391, 2777, 3529, 955,
+	1, 3, 1, 11, 5, 49, 59, 35, 261, 949, 325, 3595, 7433, 11099,
+	1, 3, 5, 9, 13, 37, 103, 219, 329, 865, 1787, 2497, 7249, 9877,
+	1, 3, 7, 9, 11, 33, 19, 255, 191, 935, 1115, 1901, 1577, 9623,
+	1, 1, 5, 7, 29, 23, 77, 43, 283, 143, 1211, 73, 2835, 10235,
+	1, 1, 7, 3, 3, 27, 35, 173, 453, 425, 1225, 3023, 2159, 8433,
+	1, 1, 1, 5, 27, 21, 35, 25, 71, 145, 1545, 523, 4527, 7655,
+	1, 1, 5, 3, 13, 49, 61, 157, 113, 775, 763, 1785, 225, 11851,
+	1, 1, 3, 1, 31, 57, 97, 229, 291, 777, 213, 4067, 921, 8203,
+	1, 1, 5, 1, 25, 13, 125, 123, 263, 207, 119, 3111, 3841, 843,
+	1, 1, 7, 7, 25, 57, 81, 129, 31, 133, 1869, 2949, 5563, 14965,
+	1, 3, 3, 7, 3, 51, 33, 127, 281, 425, 1253, 405, 7941, 8799,
+	1, 1, 3, 9, 3, 63, 93, 173, 255, 609, 49, 111, 7785, 15865,
+	1, 1, 1, 3, 17, 59, 113, 55, 155, 789, 1335, 177, 3071, 1851,
+	1, 3, 7, 15, 15, 23, 35, 35, 131, 623, 47, 437, 1337, 9891,
+	1, 3, 7, 5, 29, 57, 39, 31, 111, 271, 59, 1473, 949, 3899,
+	1, 1, 3, 11, 17, 19, 41, 229, 259, 691, 1455, 3023, 7455, 9711,
+	1, 3, 5, 11, 29, 13, 9, 165, 499, 355, 1415, 1395, 7595, 15571,
+	1, 3, 1, 9, 5, 5, 25, 247, 185, 241, 1325, 3133, 7471, 2649,
+	1, 3, 3, 11, 17, 29, 57, 61, 51, 203, 993, 1837, 3785, 15163,
+	1, 1, 7, 7, 21, 57, 79, 165, 277, 133, 93, 1055, 7169, 15685,
+	1, 1, 5, 3, 5, 17, 25, 177, 95, 323, 367, 1359, 4915, 6409,
+	1, 1, 1, 1, 11, 25, 115, 45, 373, 221, 1483, 591, 6561, 4527,
+	1, 3, 5, 3, 5, 23, 69, 77, 313, 473, 1037, 4045, 3969, 5445,
+	1, 3, 1, 5, 1, 15, 73, 83, 439, 463, 203, 361, 6835, 1061,
+	1, 1, 3, 11, 21, 5, 89, 233, 405, 253, 773, 3901, 6085, 5677,
+	1, 1, 3, 9, 15, 53, 71, 29, 101, 599, 1073, 705, 4507, 12779,
+	1, 1, 3, 1, 3, 9, 27, 97, 207, 859, 417, 735, 2179, 5071,
+	1, 1, 1, 3, 13, 63, 65, 125, 195, 611, 649, 2221, 3143, 143,
+	1, 3, 3, 15, 17, 57, 99, 119, 243, 407, 1229, 813, 5245, 1893,
+	1, 1, 1, 5, 27, 27, 49, 13, 313, 287, 473, 2629, 3509, 11371,
+	1, 1, 7, 7, 23, 3, 75, 59, 245, 689, 1215, 2375, 3325, 1593,
+	1, 3, 1, 5, 21, 51, 43, 107, 91, 611, 1405, 677, 2087, 9565,
+	1, 3, 7, 11, 9, 27, 81, 101, 449, 201, 1507, 2217, 6767, 8059,
+	1, 1, 3, 9, 13, 41, 21, 195, 421, 315, 347, 2621, 2359, 9247,
+	1, 1, 5, 7, 31, 45, 77, 229, 455, 575, 1087, 1147, 2273, 13773,
+	1, 1, 1, 1, 9, 5, 87, 19, 207, 545, 1435, 495, 1299, 4947,
+	1, 1, 3, 3, 15, 9, 63, 67, 219, 735, 1911, 2361, 6503, 11977,
+	1, 3, 1, 9, 31, 27, 103, 153, 81, 939, 461, 2753, 697, 537,
+	1, 3, 3, 9, 21, 53, 49, 211, 415, 817, 321, 3775, 2921, 9473,
+	1, 1, 7, 3, 23, 55, 15, 51, 435, 1013, 73, 3967, 4575, 13099,
+	1, 1, 3, 7, 5, 27, 43, 225, 267, 21, 1261, 603, 6913, 4421,
+	1, 1, 7, 13, 25, 31, 101, 109, 237, 91, 1587, 1987, 2795, 6991,
+	1, 1, 3, 13, 23, 51, 91, 89, 287, 39, 1513, 463, 6135, 10469,
+	1, 3, 3, 1, 9, 43, 125, 157, 369, 495, 1849, 785, 6357, 6557,
+	1, 3, 1, 13, 5, 25, 107, 139, 367, 239, 1671, 1239, 7027, 5291,
+	1, 3, 5, 13, 11, 13, 35, 177, 45, 939, 251, 59, 333, 13105,
+	1, 3, 5, 7, 29, 57, 109, 227, 435, 739, 423, 1941, 3345, 12731,
+	1, 3, 3, 9, 23, 51, 19, 207, 69, 99, 955, 519, 7305, 2415,
+	1, 1, 5, 13, 17, 1, 67, 201, 61, 403, 1059, 2915, 2419, 12773,
+	1, 3, 1, 11, 17, 19, 25, 27, 207, 299, 143, 1955, 5669, 2301,
+	1, 1, 5, 3, 25, 57, 45, 255, 489, 1011, 1699, 2637, 5279, 12211,
+	1, 3, 3, 15, 7, 47, 113, 33, 511, 907, 1815, 1741, 2091, 13857,
+	1, 3, 3, 5, 5, 27, 95, 3, 353, 253, 947, 393, 1815, 14551,
+	1, 1, 5, 11, 29, 19, 63, 117, 293, 861, 2039, 9, 5999, 6909,
+	1, 3, 7, 3, 15, 63, 107, 173, 509, 817, 99, 2825, 131, 7917,
+	1, 3, 1, 1, 29, 49, 33, 153, 119, 777, 1315, 3581, 5675, 4043,
+	1, 3, 5, 15, 13, 11, 17, 147, 327, 305, 367, 3237, 5423, 13757,
+	1, 1, 5, 13, 1, 39, 35, 29, 25, 751, 1365, 2243, 8181, 7063,
+	1, 3, 7, 11, 25, 53, 11, 111, 289, 755, 1201, 691, 3679, 3725,
+	1, 1, 1, 11, 11, 37, 33, 211, 395, 691, 1817, 861, 6485, 12077,
+	1, 3, 3, 11, 21, 3, 111, 171, 305, 561, 1501, 2011, 7841, 10931,
+	1, 3, 7, 9, 9, 59, 109, 113, 31, 915, 103, 1861, 2779, 10619,
+	1, 1, 1, 1, 7, 25, 61, 97, 103, 723, 1145, 3105, 371, 339,
+	1, 1, 7, 13, 17, 9, 113, 51, 233, 209, 1117, 211, 6969, 2347,
+	1, 1, 5, 9, 25, 43, 21, 217, 327, 735, 197, 1063, 799, 801,
+	1, 1, 7, 13, 9, 13, 73, 33, 415, 923, 863, 1999, 5383, 8119,
+	1, 3, 1, 5, 7, 33, 51, 185, 289, 967, 1277, 1011, 767, 15505,
+	1, 3, 3, 13, 21, 11, 105, 235, 343, 1021, 2009, 2251, 3865, 6923,
+	1, 3, 5, 9, 29, 11, 33, 17, 149, 155, 1739, 3039, 7015, 2401,
+	1, 3, 7, 7, 17, 13, 89, 177, 297, 267, 545, 3861, 329, 13267,
+	1, 3, 5, 15, 27, 33, 1, 231, 181, 557, 447, 379, 7845, 1295,
+	1, 1, 5, 13, 3, 63, 59, 33, 263, 877, 1867, 1383, 641, 7139,
+	1, 3, 7, 5, 13, 51, 9, 113, 223, 605, 1189, 4063, 6925, 9563,
+	1, 1, 1, 13, 5, 35, 83, 107, 295, 231, 265, 5, 4087, 6407,
+	1, 1, 5, 1, 7, 25, 95, 137, 97, 987, 1753, 2781, 1369, 6903,
+	1, 1, 5, 13, 19, 61, 77, 229, 193, 165, 811, 249, 79, 10719,
+	1, 3, 7, 7, 27, 9, 119, 193, 459, 43, 1989, 2959, 3595, 6341,
+	1, 1, 5, 11, 5, 43, 35, 33, 25, 581, 897, 351, 4201, 3971,
+	1, 1, 7, 11, 21, 29, 53, 45, 359, 197, 313, 3825, 6717, 4077,
+	1, 1, 1, 15, 3, 45, 99, 133, 357, 315, 1159, 241, 2463, 11253,
+	1, 1, 7, 11, 9, 33, 111, 85, 443, 601, 447, 337, 6471, 7029,
+	1, 3, 7, 9, 13, 33, 25, 31, 9, 729, 1763, 4077, 7575, 7877,
+	1, 3, 5, 13, 13, 37, 29, 103, 53, 229, 591, 1073, 1323, 14405,
+	1, 1, 5, 1, 17, 33, 15, 183, 473, 297, 2003, 93, 4955, 1787,
+	1, 1, 5, 13, 5, 29, 113, 161, 267, 451, 1193, 149, 273, 11809,
+	1, 1, 1, 9, 17, 39, 47, 233, 165, 373, 955, 2891, 7523, 7235,
+	1, 1, 1, 3, 7, 21, 115, 205, 153, 449, 339, 2073, 1077, 5749,
+	1, 1, 7, 13, 9, 39, 117, 187, 37, 753, 227, 3519, 7391, 5751,
+	1, 1, 1, 9, 5, 19, 41, 161, 141, 195, 1719, 3321, 5, 12877,
+	1, 3, 7, 11, 21, 13, 83, 55, 299, 75, 1905, 3765, 4685, 12297,
+	1, 1, 7, 3, 3, 23, 111, 243, 187, 297, 1061, 2515, 977, 9555,
+	1, 3, 7, 3, 29, 11, 103, 177, 225, 875, 1649, 1401, 6383, 8309,
+	1, 3, 5, 3, 3, 41, 71, 3, 373, 757, 701, 2825, 1521, 13217,
+	1, 1, 5, 3, 11, 5, 103, 227, 209, 723, 1543, 3895, 6345, 7901,
+	1, 1, 5, 1, 9, 51, 77, 67, 359, 937, 557, 993, 3871, 3577,
+	1, 3, 7, 1, 1, 15, 121, 239, 29, 113, 1123, 3877, 6941, 14129,
+	1, 1, 5, 1, 27, 61, 83, 113, 185, 601, 947, 3933, 381, 13869,
+	1, 1, 5, 3, 5, 37, 97, 31, 81, 367, 747, 1811, 5313, 14151,
+	1, 3, 5, 9, 27, 61, 87, 31, 185, 521, 837, 959, 5001, 3957,
+	1, 3, 5, 3, 11, 61, 37, 19, 107, 749, 1345, 3829, 6701, 4315,
+	1, 3, 1, 15, 13, 45, 101, 113, 243, 963, 1861, 3283, 1419, 12131,
+	1, 1, 7, 1, 11, 63, 17, 117, 271, 819, 677, 669, 1991, 12511,
+	1, 1, 1, 13, 13, 33, 41, 73, 187, 537, 993, 3147, 1013, 16063,
+	1, 3, 1, 1, 25, 21, 107, 81, 117, 917, 113, 349, 4475, 9149,
+	1, 1, 1, 11, 21, 21, 29, 251, 125, 681, 141, 2893, 5843, 14359,
+	1, 3, 3, 1, 5, 41, 85, 163, 387, 29, 1593, 221, 2769, 10809,
+	1, 3, 5, 11, 1, 17, 69, 127, 273, 449, 1855, 2971, 7031, 10583,
+	1, 1, 5, 7, 1, 61, 9, 211, 123, 563, 111, 1883, 5801, 2191,
+	1, 1, 3, 11, 11, 51, 1, 81, 405, 803, 2017, 161, 5429, 731,
+	1, 1, 7, 9, 15, 55, 65, 51, 459, 485, 1539, 3135, 2929, 7867,
+	1, 1, 7, 11, 3, 45, 15, 7, 331, 417, 1813, 4009, 1341, 10965,
+	1, 1, 1, 5, 9, 29, 89, 121, 277, 509, 1989, 1293, 4787, 16097,
+	1, 1, 3, 9, 17, 45, 97, 197, 339, 943, 1377, 2947, 5833, 7,
+	1, 1, 7, 9, 15, 61, 75, 233, 401, 705, 825, 2521, 3787, 14387,
+	1, 1, 7, 15, 25, 57, 3, 43, 361, 459, 1551, 1859, 6787, 2293,
+	1, 3, 3, 11, 11, 35, 91, 65, 43, 509, 1829, 1149, 4801, 4109,
+	1, 3, 5, 9, 15, 3, 81, 109, 231, 481, 417, 2505, 315, 6693,
+	1, 1, 3, 9, 3, 7, 107, 221, 297, 543, 149, 579, 927, 79,
+	1, 3, 1, 11, 17, 3, 81, 137, 157, 587, 741, 1277, 2631, 3953,
+	1, 1, 7, 5, 13, 43, 117, 19, 495, 185, 1105, 605, 5249, 11099,
+	1, 1, 7, 9, 23, 55, 91, 213, 21, 779, 857, 2047, 7813, 10053,
+	1, 1, 1, 1, 27, 7, 39, 181, 63, 519, 1073, 3147, 4111, 363,
+	1, 3, 7, 9, 15, 61, 7, 139, 495, 805, 1545, 3789, 2411, 3989,
+	1, 1, 3, 1, 25, 11, 23, 241, 167, 607, 479, 153, 7787, 13929,
+	1, 3, 5, 15, 29, 35, 45, 71, 457, 297, 883, 3021, 5361, 15427,
+	1, 3, 1, 7, 29, 27, 93, 241, 427, 89, 1185, 37, 3863, 14095,
+	1, 3, 1, 5, 5, 45, 51, 15, 235, 889, 1649, 2331, 2713, 10943,
+	1, 1, 3, 11, 11, 15, 71, 85, 135, 163, 139, 1147, 1043, 3195,
+	1, 3, 5, 13, 3, 43, 71, 131, 473, 933, 569, 2491, 7751, 1865,
+	1, 1, 7, 9, 21, 37, 105, 227, 329, 509, 1319, 307, 1557, 14625,
+	1, 1, 3, 13, 15, 1, 25, 93, 335, 953, 769, 4039, 369, 10727,
+	1, 3, 7, 5, 17, 21, 59, 89, 437, 679, 437, 1543, 7663, 5005,
+	1, 1, 7, 15, 27, 49, 125, 13, 397, 877, 1087, 2191, 4711, 9065,
+	1, 1, 7, 5, 15, 47, 115, 125, 187, 31, 1003, 2575, 5397, 3883,
+	1, 1, 7, 11, 15, 1, 127, 207, 383, 707, 183, 1053, 3123, 14071,
+	1, 3, 3, 1, 31, 53, 15, 19, 477, 245, 777, 1613, 5813, 7443,
+	1, 3, 1, 11, 23, 59, 65, 23, 493, 157, 1389, 2833, 4535, 3907,
+	1, 1, 7, 1, 19, 7, 51, 135, 327, 441, 1841, 3091, 3451, 14381,
+	1, 1, 7, 7, 3, 37, 29, 249, 437, 319, 1693, 945, 7639, 5923,
+	1, 3, 7, 15, 7, 61, 81, 127, 383, 99, 23, 3833, 3973, 7651,
+	1, 3, 1, 7, 7, 21, 119, 185, 243, 619, 1363, 2033, 4835, 5089,
+	1, 3, 1, 1, 3, 27, 63, 145, 271, 735, 695, 3981, 3049, 5433,
+	1, 3, 3, 1, 3, 29, 79, 211, 279, 819, 501, 3665, 1455, 10455,
+	1, 1, 3, 3, 31, 61, 113, 5, 411, 91, 489, 3257, 5939, 6715,
+	1, 1, 5, 1, 23, 11, 103, 89, 377, 441, 43, 967, 3383, 8717,
+	1, 1, 5, 13, 29, 39, 97, 189, 197, 621, 1755, 333, 6783, 9711,
+	1, 1, 5, 13, 27, 17, 97, 197, 351, 799, 335, 765, 5329, 12549,
+	1, 1, 5, 11, 29, 17, 9, 211, 127, 633, 1187, 3965, 4145, 12667,
+	1, 1, 7, 5, 27, 29, 65, 115, 287, 325, 461, 5, 899, 2027,
+	1, 1, 1, 5, 27, 17, 31, 13, 231, 627, 1163, 649, 1693, 9975,
+	1, 3, 1, 15, 7, 49, 113, 123, 427, 603, 347, 2785, 7129, 4645,
+	1, 1, 3, 7, 1, 33, 113, 105, 411, 939, 205, 3965, 4361, 4649,
+	1, 1, 1, 1, 5, 21, 35, 159, 275, 929, 1193, 3205, 4787, 3515,
+	1, 1, 1, 5, 1, 21, 29, 191, 275, 233, 1239, 515, 4349, 14989,
+	1, 1, 5, 11, 27, 43, 111, 83, 153, 577, 1537, 149, 231, 839,
+	1, 3, 5, 13, 21, 19, 57, 69, 87, 163, 271, 3535, 1057, 8517,
+	1, 3, 3, 13, 17, 49, 65, 45, 457, 241, 391, 2033, 2507, 7771,
+	1, 1, 5, 7, 11, 19, 79, 133, 341, 761, 27, 3905, 4137, 14363,
+	1, 3, 3, 13, 19, 1, 11, 139, 249, 245, 1393, 2151, 2857, 1665,
+	1, 1, 3, 15, 11, 7, 127, 47, 385, 1007, 713, 2235, 5489, 8755,
+	1, 3, 5, 13, 19, 21, 21, 167, 405, 655, 1653, 889, 7367, 4177,
+	1, 1, 5, 3, 19, 63, 99, 39, 89, 415, 951, 2863, 6569, 3797,
+	1, 1, 1, 13, 31, 29, 119, 35, 311, 839, 1749, 941, 7487, 2385,
+	1, 3, 7, 3, 17, 3, 97, 143, 465, 345, 1457, 2201, 5329, 359,
+	1, 3, 7, 11, 1, 15, 3, 115, 335, 567, 1749, 1811, 3491, 15939,
+	1, 1, 3, 13, 3, 21, 7, 141, 149, 571, 1877, 473, 2143, 9569,
+	1, 3, 3, 11, 23, 61, 47, 179, 297, 453, 181, 3405, 2981, 13409,
+	1, 3, 1, 13, 1, 43, 5, 201, 371, 1003, 367, 2709, 7675, 14973,
+	1, 3, 3, 15, 29, 17, 19, 241, 495, 317, 1135, 2227, 6457, 4783,
+	1, 3, 3, 7, 29, 9, 57, 95, 261, 531, 1717, 3389, 7991, 3793,
+	1, 1, 1, 5, 31, 43, 73, 119, 499, 589, 1529, 3337, 4097, 15641,
+	1, 1, 7, 9, 29, 43, 127, 91, 243, 979, 1325, 2835, 2787, 9445,
+	1, 1, 7, 5, 9, 3, 115, 199, 219, 901, 747, 1077, 3197, 2443,
+	1, 3, 5, 1, 3, 43, 7, 117, 297, 313, 1043, 1579, 5099, 13289,
+	1, 1, 7, 11, 29, 33, 15, 121, 131, 579, 317, 1871, 1121, 11653,
+	1, 1, 5, 9, 25, 25, 43, 89, 355, 1011, 1385, 2901, 6387, 1653,
+	1, 1, 1, 9, 5, 47, 61, 165, 85, 757, 1397, 1177, 1657, 4899,
+	1, 1, 3, 9, 11, 49, 15, 139, 261, 613, 931, 1299, 2777, 2835,
+	1, 1, 1, 5, 3, 55, 83, 227, 125, 581, 1607, 1171, 6681, 14463,
+	1, 3, 5, 13, 5, 55, 3, 247, 493, 155, 1073, 3743, 5719, 4019,
+	1, 1, 7, 1, 11, 23, 13, 75, 399, 847, 499, 1643, 6977, 3699,
+	1, 3, 1, 9, 11, 41, 47, 131, 313, 627, 481, 2469, 3281, 979,
+	1, 3, 5, 13, 29, 3, 65, 101, 11, 29, 1807, 153, 1487, 16109,
+	1, 1, 5, 9, 13, 31, 83, 195, 351, 355, 467, 3871, 3085, 4441,
+	1, 3, 5, 3, 19, 21, 111, 179, 143, 361, 1619, 1547, 3409, 6905,
+	1, 1, 5, 9, 31, 1, 93, 199, 491, 135, 1627, 2559, 1389, 14561,
+	1, 3, 3, 9, 25, 53, 3, 105, 39, 445, 259, 1045, 1129, 9153,
+	1, 1, 5, 9, 19, 63, 71, 9, 73, 435, 1377, 4015, 1821, 6453,
+	1, 3, 7, 13, 19, 13, 37, 247, 391, 23, 1491, 1257, 6395, 237,
+	1, 1, 3, 3, 19, 55, 109, 23, 227, 747, 729, 2221, 727, 2209,
+	1, 1, 5, 11, 25, 21, 75, 37, 219, 355, 1005, 1895, 7039, 5225,
+	1, 3, 5, 13, 11, 43, 9, 67, 87, 797, 1077, 245, 4521, 11845,
+	1, 3, 5, 3, 15, 29, 127, 237, 277, 373, 1859, 3083, 587, 1123,
+	1, 1, 7, 15, 13, 7, 103, 53, 13, 965, 1497, 775, 3439, 1501,
+	1, 3, 3, 15, 17, 13, 97, 169, 67, 953, 189, 2739, 1459, 10543,
+	1, 1, 5, 1, 17, 39, 15, 127, 327, 989, 1471, 3235, 2801, 15311,
+	1, 1, 1, 15, 5, 37, 55, 155, 47, 463, 1851, 3467, 2765, 9359,
+	1, 3, 3, 15, 1, 13, 93, 239, 291, 115, 365, 61, 395, 15853,
+	1, 1, 5, 1, 19, 27, 61, 95, 105, 369, 1557, 961, 6917, 3621,
+	1, 3, 3, 9, 7, 35, 115, 53, 111, 345, 1145, 1687, 3401, 12107,
+	1, 1, 1, 5, 7, 31, 63, 19, 373, 79, 1369, 3037, 2835, 4439,
+	1, 3, 7, 9, 11, 17, 29, 33, 331, 447, 1981, 3333, 6535, 6557,
+	1, 3, 3, 5, 11, 41, 29, 43, 365, 279, 1919, 945, 179, 1987,
+	1, 3, 1, 13, 7, 7, 25, 33, 103, 367, 1267, 763, 5691, 8643,
+	1, 3, 1, 5, 11, 15, 3, 213, 511, 211, 1069, 4047, 3335, 12729,
+	1, 1, 3, 1, 5, 11, 27, 201, 361, 537, 679, 3709, 293, 2997,
+	1, 1, 3, 1, 25, 15, 19, 185, 369, 577, 1625, 655, 2363, 3861,
+	1, 1, 5, 5, 1, 47, 61, 45, 411, 597, 955, 1007, 3775, 5809,
+	1, 1, 5, 3, 27, 51, 101, 167, 429, 333, 1703, 3541, 2947, 3695,
+	1, 3, 5, 5, 1, 53, 17, 63, 141, 215, 1223, 3129, 635, 15919,
+	1, 3, 3, 1, 23, 31, 25, 11, 195, 241, 995, 3941, 573, 13855,
+	1, 3, 3, 7, 17, 13, 71, 203, 465, 479, 1857, 1493, 8067, 7113,
+	1, 1, 5, 3, 11, 57, 9, 59, 225, 691, 425, 2423, 6031, 6631,
+	1, 3, 7, 1, 29, 57, 103, 123, 401, 807, 471, 2759, 5113, 15937,
+	1, 3, 1, 1, 3, 1, 67, 123, 157, 655, 519, 323, 1853, 15041,
+	1, 1, 7, 5, 11, 11, 105, 135, 247, 689, 1141, 2347, 7113, 9347,
+	1, 1, 3, 11, 15, 37, 87, 3, 209, 575, 1521, 3863, 3893, 211,
+	1, 3, 1, 3, 29, 55, 115, 31, 19, 195, 985, 3275, 363, 9801,
+	1, 1, 3, 9, 13, 31, 57, 251, 201, 275, 1751, 389, 1463, 13159,
+	1, 3, 5, 15, 19, 51, 127, 255, 397, 243, 29, 3007, 7845, 4687,
+	1, 1, 7, 15, 9, 37, 39, 217, 509, 137, 1123, 3361, 6323, 5323,
+	1, 3, 7, 5, 25, 3, 93, 203, 345, 581, 261, 2811, 4829, 6977,
+	1, 1, 7, 1, 15, 41, 51, 227, 447, 893, 1209, 3865, 5229, 4277,
+	1, 1, 1, 5, 31, 19, 23, 195, 359, 853, 595, 337, 2503, 16371,
+	1, 3, 7, 5, 5, 13, 89, 157, 351, 777, 151, 3565, 4219, 7423,
+	1, 1, 1, 5, 7, 1, 9, 89, 175, 909, 1523, 2295, 7949, 6739,
+	1, 3, 5, 15, 27, 17, 11, 235, 19, 105, 457, 465, 3819, 11335,
+	1, 3, 1, 13, 3, 41, 85, 221, 451, 613, 543, 2265, 6831, 1725,
+	1, 1, 7, 7, 3, 29, 9, 197, 455, 665, 343, 1811, 5395, 393,
+	1, 1, 3, 13, 29, 55, 71, 95, 475, 615, 2029, 123, 413, 16127,
+	1, 1, 5, 9, 15, 61, 9, 51, 105, 271, 511, 2801, 693, 11839,
+	1, 1, 7, 13, 29, 9, 105, 59, 377, 635, 717, 4033, 6963, 10541,
+	1, 1, 1, 13, 7, 13, 59, 17, 335, 355, 77, 3665, 7003, 9521,
+	1, 3, 1, 1, 23, 43, 51, 209, 151, 365, 1021, 2859, 3937, 2899,
+	1, 1, 3, 3, 31, 41, 111, 107, 171, 433, 1233, 505, 2971, 6927,
+	1, 3, 7, 13, 17, 25, 127, 195, 257, 551, 1867, 2145, 3695, 14567,
+	1, 1, 5, 13, 13, 45, 39, 195, 55, 991, 1981, 1043, 5875, 581,
+	1, 3, 3, 11, 25, 31, 91, 153, 415, 449, 1301, 563, 7755, 10671,
+	1, 1, 3, 5, 31, 63, 1, 157, 229, 949, 971, 137, 6589, 8387,
+	1, 3, 7, 15, 25, 7, 89, 133, 73, 497, 1361, 613, 455, 1005,
+	1, 3, 3, 1, 13, 5, 119, 93, 175, 511, 1923, 763, 7573, 7545,
+	1, 1, 3, 15, 27, 59, 49, 205, 497, 485, 117, 2523, 4495, 15153,
+	1, 3, 7, 9, 15, 47, 111, 31, 363, 11, 475, 2931, 6813, 1259,
+	1, 1, 5, 5, 1, 35, 95, 225, 17, 991, 809, 2601, 6455, 13803,
+	1, 1, 5, 5, 15, 1, 1, 171, 433, 887, 1813, 3431, 2471, 7803,
+	1, 3, 3, 15, 1, 15, 43, 179, 15, 949, 1881, 1027, 6989, 8955,
+	1, 3, 7, 13, 1, 3, 49, 183, 373, 175, 1733, 913, 929, 1065,
+	1, 3, 5, 7, 15, 51, 107, 115, 323, 357, 167, 2069, 7541, 9601,
+	1, 1, 3, 5, 5, 21, 31, 107, 21, 299, 1937, 43, 3673, 8155,
+	1, 3, 5, 11, 9, 55, 35, 113, 29, 99, 161, 1607, 8141, 4951,
+	1, 3, 7, 15, 25, 7, 113, 179, 213, 19, 1717, 1027, 2021, 11263,
+	1, 1, 5, 1, 31, 33, 85, 111, 67, 95, 2013, 2217, 871, 5329,
+	1, 1, 1, 7, 7, 63, 67, 145, 495, 419, 1945, 3437, 6255, 151,
+	1, 3, 5, 7, 17, 37, 97, 187, 215, 399, 1603, 2195, 5923, 769,
+	1, 1, 3, 9, 25, 1, 119, 193, 385, 861, 2005, 2769, 675, 767,
+	1, 3, 1, 15, 19, 7, 5, 227, 173, 383, 289, 461, 579, 3689,
+	1, 3, 1, 11, 1, 37, 93, 239, 465, 891, 1479, 921, 4439, 15265,
+	1, 1, 1, 13, 27, 61, 99, 69, 279, 655, 1853, 1593, 6319, 9003,
+	1, 1, 1, 11, 5, 7, 19, 7, 387, 303, 321, 931, 5809, 16029,
+	1, 1, 1, 15, 21, 55, 43, 107, 217, 687, 19, 3225, 3419, 9991,
+	1, 1, 7, 5, 7, 55, 79, 41, 317, 357, 859, 1205, 191, 9395,
+	1, 1, 3, 11, 3, 43, 7, 133, 115, 995, 1205, 1055, 4153, 10481,
+	1, 1, 7, 11, 31, 57, 53, 9, 459, 223, 1969, 3513, 7033, 8505,
+	1, 1, 3, 7, 17, 11, 115, 255, 281, 97, 1685, 2039, 2845, 11637,
+	1, 3, 7, 1, 23, 41, 69, 199, 53, 105, 657, 1453, 4429, 1101,
+	1, 3, 1, 5, 11, 33, 91, 131, 191, 73, 823, 117, 1053, 127,
+	1, 3, 7, 11, 7, 3, 21, 65, 187, 103, 1393, 1797, 6673, 1409,
+	1, 3, 7, 1, 31, 25, 25, 161, 299, 275, 417, 2267, 6861, 1255,
+	1, 3, 5, 13, 5, 11, 61, 155, 115, 1001, 747, 889, 3235, 5709,
+	1, 3, 7, 7, 7, 1, 97, 177, 507, 273, 1781, 3455, 5123, 15607,
+	1, 1, 7, 5, 1, 7, 59, 49, 147, 343, 97, 3517, 5611, 8705,
+	1, 1, 5, 13, 21, 29, 13, 21, 503, 515, 1217, 3905, 5513, 15849,
+	1, 3, 1, 9, 9, 39, 65, 111, 385, 757, 583, 2225, 2039, 2817,
+	1, 3, 3, 15, 23, 17, 63, 169, 503, 949, 849, 461, 6799, 669,
+	1, 1, 1, 3, 1, 41, 63, 159, 251, 457, 521, 1653, 623, 3287,
+	1, 1, 7, 3, 9, 1, 41, 37, 441, 921, 1415, 2955, 5841, 1451,
+	1, 1, 5, 11, 23, 29, 89, 185, 413, 357, 1131, 2369, 3835, 6233,
+	1, 1, 5, 15, 27, 35, 17, 73, 315, 911, 1761, 797, 5349, 3219,
+	1, 3, 7, 11, 21, 9, 119, 233, 249, 901, 189, 3625, 2691, 16201,
+	1, 3, 3, 13, 29, 61, 105, 145, 187, 79, 609, 321, 4289, 3933,
+	1, 3, 1, 15, 19, 63, 13, 185, 115, 219, 1021, 1205, 4273, 11521,
+	1, 1, 3, 3, 23, 31, 93, 153, 87, 947, 1039, 469, 4047, 8869,
+	1, 1, 1, 1, 9, 1, 85, 3, 15, 995, 455, 2769, 6781, 16203,
+	1, 1, 3, 3, 13, 7, 55, 215, 185, 367, 765, 441, 4497, 1521,
+	1, 1, 1, 5, 1, 31, 13, 95, 417, 735, 975, 3407, 4871, 16133,
+	1, 1, 3, 3, 5, 43, 111, 107, 419, 515, 1075, 3597, 1187, 4143,
+	1, 1, 3, 13, 31, 51, 83, 163, 489, 887, 863, 599, 9, 13861,
+	1, 3, 3, 3, 19, 27, 91, 115, 103, 969, 593, 3667, 1867, 15433,
+	1, 3, 3, 13, 7, 25, 47, 141, 57, 553, 1785, 1709, 7453, 2209,
+	1, 3, 1, 13, 11, 13, 71, 219, 5, 451, 2043, 1605, 6439, 12203,
+	1, 3, 1, 13, 5, 57, 61, 223, 401, 413, 321, 1365, 619, 12477,
+	1, 3, 1, 5, 25, 57, 89, 211, 195, 455, 1165, 3979, 6313, 5751,
+	1, 1, 1, 9, 31, 23, 71, 145, 89, 285, 1593, 1171, 5685, 15459,
+	1, 3, 7, 7, 9, 41, 65, 251, 65, 137, 1577, 3027, 5555, 2865,
+	1, 1, 5, 13, 27, 5, 125, 21, 171, 647, 983, 2921, 6623, 5695,
+	1, 1, 1, 13, 15, 9, 117, 197, 123, 953, 1191, 3657, 5757, 15957,
+	1, 1, 3, 7, 29, 13, 5, 175, 395, 127, 679, 255, 6055, 7639,
+	1, 3, 7, 15, 15, 51, 77, 147, 319, 147, 1775, 3983, 3175, 5723,
+	1, 3, 3, 3, 7, 11, 119, 41, 43, 153, 975, 679, 3081, 10359,
+	1, 1, 5, 13, 3, 7, 65, 67, 63, 399, 1561, 2789, 2083, 12289,
+	1, 1, 7, 3, 19, 53, 103, 67, 35, 865, 161, 93, 2533, 3851,
+	1, 1, 1, 11, 31, 9, 29, 189, 199, 817, 1571, 395, 345, 3777,
+	1, 3, 5, 11, 31, 3, 9, 67, 277, 735, 181, 2777, 3009, 7233,
+	1, 1, 3, 3, 17, 7, 17, 3, 375, 933, 237, 3919, 5409, 3355,
+	1, 3, 3, 5, 9, 27, 19, 77, 221, 3, 1965, 309, 3001, 15977,
+	1, 1, 5, 1, 3, 33, 35, 133, 37, 709, 627, 1705, 2525, 4307,
+	1, 1, 7, 3, 25, 21, 105, 55, 375, 681, 881, 1299, 5879, 459,
+	1, 3, 7, 1, 13, 7, 113, 103, 313, 515, 1041, 3683, 4619, 5093,
+	1, 1, 3, 7, 19, 43, 83, 37, 39, 133, 1759, 1171, 1521, 13717,
+	1, 1, 7, 13, 7, 35, 15, 155, 293, 1001, 157, 3883, 405, 1797,
+	1, 1, 3, 3, 13, 19, 125, 49, 333, 387, 339, 1815, 4503, 7359,
+	1, 1, 3, 13, 19, 19, 105, 225, 151, 27, 1251, 885, 4815, 7863,
+	1, 1, 1, 5, 7, 59, 17, 145, 77, 117, 1355, 1429, 2301, 16177,
+	1, 3, 3, 13, 5, 31, 119, 167, 459, 727, 1799, 2537, 695, 13637,
+	1, 3, 3, 3, 27, 51, 107, 85, 267, 57, 1279, 823, 6247, 3603,
+	1, 1, 7, 15, 29, 17, 67, 197, 215, 465, 109, 3461, 5269, 15287,
+	1, 1, 3, 5, 11, 15, 123, 53, 293, 797, 1105, 1777, 6509, 217,
+	1, 3, 3, 13, 3, 5, 109, 53, 203, 693, 871, 135, 369, 11149,
+	1, 3, 5, 15, 17, 43, 81, 235, 119, 817, 1777, 261, 8049, 4251,
+	1, 1, 3, 7, 7, 13, 87, 99, 481, 931, 1507, 651, 5267, 8281,
+	1, 3, 1, 13, 27, 43, 77, 225, 341, 163, 933, 429, 4943, 7781,
+	1, 1, 7, 1, 1, 49, 85, 211, 449, 479, 1395, 787, 5653, 14891,
+	1, 1, 5, 9, 25, 13, 49, 85, 125, 85, 1281, 3365, 4305, 11791,
+	1, 3, 1, 13, 3, 31, 117, 39, 43, 151, 663, 669, 1571, 5207,
+	1, 3, 7, 15, 17, 7, 79, 163, 37, 841, 1799, 1787, 4501, 3785,
+	1, 1, 3, 9, 1, 23, 67, 191, 449, 931, 1521, 2705, 887, 7037,
+	1, 1, 1, 1, 5, 13, 55, 161, 419, 577, 1703, 2589, 2651, 2873,
+	1, 3, 3, 3, 5, 19, 37, 169, 69, 1003, 1755, 3101, 1469, 8583,
+	1, 1, 1, 1, 11, 33, 105, 79, 283, 91, 299, 835, 3193, 5593,
+	1, 3, 3, 13, 25, 21, 81, 213, 465, 475, 331, 457, 61, 9511,
+	1, 1, 3, 11, 1, 11, 77, 95, 455, 949, 1999, 1833, 1275, 5631,
+	1, 1, 1, 1, 15, 25, 51, 137, 275, 451, 1179, 3595, 5177, 7105,
+	1, 3, 3, 3, 3, 59, 79, 143, 393, 583, 349, 3039, 7079, 14245,
+	1, 1, 7, 9, 21, 11, 123, 105, 53, 297, 803, 4025, 5421, 14527,
+	1, 3, 7, 11, 21, 15, 103, 109, 311, 321, 1217, 2777, 5457, 1823,
+	1, 3, 5, 11, 19, 31, 79, 89, 295, 413, 817, 499, 3699, 14411,
+	1, 1, 1, 5, 11, 3, 81, 13, 315, 841, 1543, 411, 6883, 6347,
+	1, 3, 3, 11, 23, 43, 23, 131, 17, 517, 995, 2687, 7443, 15085,
+	1, 1, 1, 1, 11, 57, 73, 9, 123, 905, 1763, 1789, 3701, 7131,
+	1, 1, 3, 5, 9, 53, 99, 229, 43, 207, 625, 1583, 6727, 15249,
+	1, 1, 7, 7, 17, 39, 91, 1, 297, 711, 225, 513, 7391, 291,
+	1, 1, 7, 11, 7, 55, 111, 129, 423, 521, 1807, 3015, 1449, 12321,
+	1, 3, 7, 3, 13, 9, 125, 187, 11, 485, 647, 275, 3495, 11989
+};
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
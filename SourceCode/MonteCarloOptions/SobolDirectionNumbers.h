@@ -0,0 +1,30 @@
+#ifndef SOBOL_DIRECTION_NUMBERS_H
+#define SOBOL_DIRECTION_NUMBERS_H
+
+#include <cstdint>
+
+// Initial direction numbers of Joe and Kuo (2008), from their file new-joe-kuo-6.21201, for
+// dimensions 2 to joeKuoMaxDimension, that is for all the primitive polynomials of degree up
+// to 14 in the order SobolSequence enumerates them.  Dimension d takes the s numbers
+// m_1, ..., m_s, s the degree of its polynomial, following those of dimension d - 1.
+constexpr unsigned joeKuoMaxDimension = 1867;
+
+extern const std::uint16_t joeKuoInitialNumbers[];
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,226 @@
+#include "SobolSequence.h"
+#include "SobolDirectionNumbers.h"
+#include <stdexcept>
+#include <string>
+
+using std::vector;
+using std::uint32_t;
+using std::uint64_t;
+
+namespace
+{
+	// x^degree + a_1 x^(degree - 1) + ... + a_(degree - 1) x + 1 over GF(2), with the
+	// bits of a = a_1 a_2 ... a_(degree - 1) (a_1 the most significant), as in Joe and Kuo.
+	struct Polynomial
+	{
+		int degree;
+		uint32_t a;
+	};
+
+	// Polynomials over GF(2) are stored as bit masks, bit j holding the coefficient of x^j.
+	uint64_t polyMulMod_(uint64_t f, uint64_t g, uint64_t p, int degree)
+	{
+		uint64_t result = 0;
+		for (; g != 0; g >>= 1)
+		{
+			if (g & 1)
+			{
+				result ^= f;
+			}
+			f <<= 1;
+			if ((f >> degree) & 1)
+			{
+				f ^= p;
+			}
+		}
+		return result;
+	}
+
+	uint64_t xPowMod_(uint64_t e, uint64_t p, int degree)	// x^e mod p
+	{
+		uint64_t result = 1;
+		uint64_t base = (degree == 1) ? (2 ^ p) : 2;		// x mod p
+		for (; e != 0; e >>= 1)
+		{
+			if (e & 1)
+			{
+				result = polyMulMod_(result, base, p, degree);
+			}
+			base = polyMulMod_(base, base, p, degree);
+		}
+		return result;
+	}
+
+	vector<uint64_t> primeFactors_(uint64_t n)
+	{
+		vector<uint64_t> factors;
+		for (uint64_t q = 2; q * q <= n; ++q)
+		{
+			if (n % q == 0)
+			{
+				factors.push_back(q);
+				while (n % q == 0)
+				{
+					n /= q;
+				}
+			}
+		}
+		if (n > 1)
+		{
+			factors.push_back(n);
+		}
+		return factors;
+	}
+
+	// p of degree s is primitive iff x has multiplicative order exactly 2^s - 1 modulo p.
+	vector<Polynomial> primitivePolynomials_(unsigned count)
+	{
+		vector<Polynomial> polys;
+		for (int degree = 1; polys.size() < count; ++degree)
+		{
+			if (degree >= SobolSequence::numBits)
+			{
+				throw std::invalid_argument("SobolSequence: dimension too large");
+			}
+			uint64_t order = (uint64_t(1) << degree) - 1;
+			vector<uint64_t> factors = primeFactors_(order);
+
+			for (uint32_t a = 0; a < (1u << (degree - 1)) && polys.size() < count; ++a)
+			{
+				uint64_t p = (uint64_t(1) << degree) | (uint64_t(a) << 1) | 1;
+				if (xPowMod_(order, p, degree) != 1)
+				{
+					continue;
+				}
+				bool primitive = true;
+				for (uint64_t q : factors)
+				{
+					if (xPowMod_(order / q, p, degree) == 1)
+					{
+						primitive = false;
+						break;
+					}
+				}
+				if (primitive)
+				{
+					polys.push_back({ degree, a });
+				}
+			}
+		}
+		return polys;
+	}
+}
+
+SobolSequence::SobolSequence(unsigned dimension) :dimension_(dimension),
+	directions_(static_cast<std::size_t>(dimension) * numBits)
+{
+	if (dimension == 0)
+	{
+		throw std::invalid_argument("SobolSequence: dimension must be positive");
+	}
+	if (dimension > joeKuoMaxDimension)
+	{
+		throw std::invalid_argument("SobolSequence: dimension above "
+			+ std::to_string(joeKuoMaxDimension) + " is not supported");
+	}
+
+	// Dimension 1 is the van der Corput sequence in base 2:
+	for (int k = 0; k < numBits; ++k)
+	{
+		directions_[k] = 1u << (numBits - 1 - k);
+	}
+
+	vector<Polynomial> polys = primitivePolynomials_(dimension - 1);
+	const std::uint16_t* init = joeKuoInitialNumbers;
+	vector<uint64_t> m(numBits);
+
+	for (unsigned d = 1; d < dimension; ++d)
+	{
+		int s = polys[d - 1].degree;
+		uint32_t a = polys[d - 1].a;
+
+		for (int k = 0; k < s; ++k)		// m_(k+1) odd and less than 2^(k+1)
+		{
+			m[k] = init[k];
+		}
+		init += s;
+		for (int k = s; k < numBits; ++k)
+		{
+			m[k] = m[k - s] ^ (m[k - s] << s);
+			for (int j = 1; j < s; ++j)
+			{
+				if ((a >> (s - 1 - j)) & 1)
+				{
+					m[k] ^= m[k - j] << j;
+				}
+			}
+		}
+		for (int k = 0; k < numBits; ++k)
+		{
+			directions_[d * numBits + k] = static_cast<uint32_t>(m[k] << (numBits - 1 - k));
+		}
+	}
+}
+
+unsigned SobolSequence::dimension() const
+{
+	return dimension_;
+}
+
+void SobolSequence::skipTo(uint64_t index, uint32_t* x) const
+{
+	uint64_t gray = index ^ (index >> 1);
+	for (unsigned d = 0; d < dimension_; ++d)
+	{
+		uint32_t xd = 0;
+		const uint32_t* v = directions_.data() + d * numBits;
+		for (int k = 0; k < numBits; ++k)
+		{
+			if ((gray >> k) & 1)
+			{
+				xd ^= v[k];
+			}
+		}
+		x[d] = xd;
+	}
+}
+
+void SobolSequence::next(uint64_t index, uint32_t* x) const
+{
+	// Antonov-Saleev:  consecutive Gray codes differ in the bit at the position of the
+	// lowest zero bit of index.
+	int c = 0;
+	while ((index >> c) & 1)
+	{
+		++c;
+	}
+	for (unsigned d = 0; d < dimension_; ++d)
+	{
+		x[d] ^= directions_[d * numBits + c];
+	}
+}
+
+void SobolSequence::toUniforms(const uint32_t* x, const uint32_t* shift, double* u) const
+{
+	for (unsigned d = 0; d < dimension_; ++d)
+	{
+		uint32_t xd = shift ? (x[d] ^ shift[d]) : x[d];
+		u[d] = (static_cast<double>(xd) + 0.5) * 0x1.0p-32;
+	}
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
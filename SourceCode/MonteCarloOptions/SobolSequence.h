@@ -0,0 +1,56 @@
+#ifndef SOBOL_SEQUENCE_H
+#define SOBOL_SEQUENCE_H
+
+#include <vector>
+#include <cstdint>
+
+// Sobol low-discrepancy sequence in any number of dimensions, generated in Gray-code
+// order with 32-bit direction numbers.  The primitive polynomials are enumerated in the
+// order of Joe and Kuo (2008), with their initial direction numbers, up to dimension
+// joeKuoMaxDimension (see SobolDirectionNumbers.h); higher dimensions are rejected.
+//
+// Points are kept as 32-bit integers so that a random digital shift (XOR with one random
+// word per dimension) can be applied when they are converted to uniforms; independent
+// shifts give independent randomized replications of the point set, from which a
+// standard error can be estimated.
+class SobolSequence
+{
+public:
+	explicit SobolSequence(unsigned dimension);
+
+	unsigned dimension() const;
+
+	// Sets x to point number index, in O(dimension * 32) operations:
+	void skipTo(std::uint64_t index, std::uint32_t* x) const;
+
+	// Advances x from point number index to point number index + 1, in O(dimension):
+	void next(std::uint64_t index, std::uint32_t* x) const;
+
+	// Converts an integer point to uniforms strictly inside (0, 1), applying the digital
+	// shift first unless shift is nullptr.
+	void toUniforms(const std::uint32_t* x, const std::uint32_t* shift, double* u) const;
+
+	static constexpr int numBits = 32;	// At most 2^32 points
+
+private:
+	unsigned dimension_;
+	std::vector<std::uint32_t> directions_;	// Direction number k of dimension d at [d * numBits + k]
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
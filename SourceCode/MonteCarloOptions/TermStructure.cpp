@@ -0,0 +1,79 @@
+#include "TermStructure.h"
+#include <algorithm>
+#include <stdexcept>
+
+using std::vector;
+
+TermStructure::TermStructure(double value) :times_{ 1.0 }, values_{ value } {}
+
+TermStructure::TermStructure(const vector<double>& times, const vector<double>& values) :
+	times_(times), values_(values)
+{
+	if (times_.empty() || times_.size() != values_.size())
+	{
+		throw std::invalid_argument("TermStructure: need one value per time, and at least one");
+	}
+	for (std::size_t j = 0; j < times_.size(); ++j)
+	{
+		if (times_[j] <= (j > 0 ? times_[j - 1] : 0.0))
+		{
+			throw std::invalid_argument("TermStructure: times must be positive and increasing");
+		}
+	}
+}
+
+double TermStructure::operator()(double t) const
+{
+	// First j with t <= times_[j]:
+	auto j = std::lower_bound(times_.begin(), times_.end(), t) - times_.begin();
+	return values_[std::min<std::size_t>(j, values_.size() - 1)];
+}
+
+double TermStructure::integral(double t0, double t1) const
+{
+	return integrate_(t0, t1, false);
+}
+
+double TermStructure::integralOfSquare(double t0, double t1) const
+{
+	return integrate_(t0, t1, true);
+}
+
+double TermStructure::integrate_(double t0, double t1, bool squared) const
+{
+	if (t1 < t0)
+	{
+		throw std::invalid_argument("TermStructure: integration bounds must satisfy t0 <= t1");
+	}
+
+	double sum = 0.0;
+	double left = 0.0;
+	for (std::size_t j = 0; j < values_.size() && left < t1; ++j)
+	{
+		// Overlap of [t0, t1] with the piece (left, times_[j]]; the last piece is unbounded:
+		double right = (j + 1 < values_.size()) ? times_[j] : t1;
+		double length = std::min(right, t1) - std::max(left, t0);
+		if (length > 0.0)
+		{
+			sum += length * (squared ? values_[j] * values_[j] : values_[j]);
+		}
+		left = right;
+	}
+	return sum;
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,45 @@
+#ifndef TERM_STRUCTURE_H
+#define TERM_STRUCTURE_H
+
+#include <vector>
+
+// Piecewise-constant function of time, for short rates and volatilities:  values[j] applies
+// on (times[j-1], times[j]] (with times[-1] = 0), and values.back() also beyond times.back().
+// Times are year fractions from the valuation date.
+class TermStructure
+{
+public:
+	TermStructure(double value);		// Flat
+	TermStructure(const std::vector<double>& times, const std::vector<double>& values);
+
+	double operator()(double t) const;
+
+	// Integrals of the function and of its square over [t0, t1], t0 <= t1:  for a short rate
+	// r, the log discount factor; for a volatility sigma, the variance of the log price.
+	double integral(double t0, double t1) const;
+	double integralOfSquare(double t0, double t1) const;
+
+private:
+	double integrate_(double t0, double t1, bool squared) const;
+
+	std::vector<double> times_;
+	std::vector<double> values_;
+};
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
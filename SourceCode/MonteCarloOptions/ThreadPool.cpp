@@ -0,0 +1,153 @@
+#include "ThreadPool.h"
+#include <map>
+#include <memory>
+
+namespace
+{
+	// Set on each worker thread, for workerIndex():
+	thread_local const ThreadPool* currentPool_ = nullptr;
+	thread_local int currentIndex_ = -1;
+}
+
+ThreadPool::ThreadPool(unsigned numThreads)
+{
+	if (numThreads == 0)
+	{
+		numThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	workers_.reserve(numThreads);
+	for (unsigned i = 0; i < numThreads; ++i)
+	{
+		workers_.emplace_back(&ThreadPool::workerLoop_, this, static_cast<int>(i));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	jobAvailable_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+}
+
+unsigned ThreadPool::size() const
+{
+	return static_cast<unsigned>(workers_.size());
+}
+
+ThreadPool& ThreadPool::shared(unsigned numThreads)
+{
+	static std::mutex mutex;
+	static std::map<unsigned, std::unique_ptr<ThreadPool> > pools;
+
+	if (numThreads == 0)
+	{
+		numThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& pool = pools[numThreads];
+	if (!pool)
+	{
+		pool = std::make_unique<ThreadPool>(numThreads);
+	}
+	return *pool;
+}
+
+int ThreadPool::workerIndex() const
+{
+	return (currentPool_ == this) ? currentIndex_ : -1;
+}
+
+void ThreadPool::runOnWorkers_(int numJobs, void* context, void (*run)(void*))
+{
+	std::lock_guard<std::mutex> call(callMutex_);
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		context_ = context;
+		run_ = run;
+		jobsToStart_ = numJobs;
+	}
+	jobAvailable_.notify_all();
+
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		jobsDone_.wait(lock, [this]() {return jobsToStart_ == 0 && jobsRunning_ == 0; });
+		std::swap(error, error_);
+	}
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+void ThreadPool::workerLoop_(int index)
+{
+	currentPool_ = this;
+	currentIndex_ = index;
+	for (;;)
+	{
+		void* context;
+		void (*run)(void*);
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			jobAvailable_.wait(lock, [this]() {return stop_ || jobsToStart_ > 0; });
+			if (stop_ && jobsToStart_ == 0)
+			{
+				return;
+			}
+			--jobsToStart_;
+			++jobsRunning_;
+			context = context_;
+			run = run_;
+		}
+
+		std::exception_ptr error;
+		try
+		{
+			run(context);
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+
+		bool done;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (error && !error_)
+			{
+				error_ = error;
+			}
+			done = --jobsRunning_ == 0 && jobsToStart_ == 0;
+		}
+		if (done)
+		{
+			jobsDone_.notify_all();
+		}
+	}
+}
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,123 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <atomic>
+#include <algorithm>
+
+// Fixed-size pool of worker threads.  The threads are started once in the
+// constructor and joined in the destructor, so repeated parallel loops do not
+// pay for thread creation the way one std::async per work item does.  Nor do they
+// allocate:  a loop is handed to the workers as a pointer to the caller's stack.
+class ThreadPool
+{
+public:
+	explicit ThreadPool(unsigned numThreads = 0);	// 0 => std::thread::hardware_concurrency()
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	unsigned size() const;
+
+	// Pool of numThreads workers (0 => std::thread::hardware_concurrency()) shared by all
+	// the pricers of the process.  It is started on first use and kept until exit, so that
+	// pricers constructed one after another do not each start and join their own threads.
+	// A task running on a pool must not call parallelFor(.) on the same pool.
+	static ThreadPool& shared(unsigned numThreads = 0);
+
+	// Index of the calling thread among the workers of this pool, 0, ..., size() - 1, or -1
+	// for any other thread.  Tasks can use it to pick per-thread resources.
+	int workerIndex() const;
+
+	// Runs task(k) for k = 0, 1, ..., numTasks - 1 and blocks until all have finished.
+	// Each worker claims the next unprocessed index from a shared counter, so a slow
+	// task does not hold up the others.  An exception thrown by a task is rethrown here.
+	// Calls from several threads are run one after the other.
+	template<typename Task>
+	void parallelFor(int numTasks, Task task);
+
+private:
+	// Runs run(context) on numJobs workers, and blocks until all have returned:
+	void runOnWorkers_(int numJobs, void* context, void (*run)(void*));
+	void workerLoop_(int index);
+
+	std::vector<std::thread> workers_;
+	std::mutex callMutex_;		// Held for a whole parallelFor(.)
+	std::mutex mutex_;
+	std::condition_variable jobAvailable_;
+	std::condition_variable jobsDone_;
+
+	// The current loop, guarded by mutex_:
+	void* context_ = nullptr;
+	void (*run_)(void*) = nullptr;
+	int jobsToStart_ = 0;
+	int jobsRunning_ = 0;
+	std::exception_ptr error_;		// First exception thrown by a job
+	bool stop_ = false;
+};
+
+// As pool->parallelFor(numTasks, task), or, without a pool, task(0), ..., task(numTasks - 1)
+// in order on the calling thread:
+template<typename Task>
+void forEachTask(ThreadPool* pool, int numTasks, Task task);
+
+template<typename Task>
+void ThreadPool::parallelFor(int numTasks, Task task)
+{
+	if (numTasks <= 0)
+	{
+		return;
+	}
+
+	std::atomic<int> nextTask(0);
+	auto drain = [&nextTask, &task, numTasks]()
+	{
+		for (int k = nextTask++; k < numTasks; k = nextTask++)
+		{
+			task(k);
+		}
+	};
+
+	int numJobs = std::min(static_cast<int>(size()), numTasks);
+	runOnWorkers_(numJobs, &drain, [](void* context)
+	{
+		(*static_cast<decltype(drain)*>(context))();
+	});
+}
+
+template<typename Task>
+void forEachTask(ThreadPool* pool, int numTasks, Task task)
+{
+	if (pool)
+	{
+		pool->parallelFor(numTasks, task);
+		return;
+	}
+	for (int k = 0; k < numTasks; ++k)
+	{
+		task(k);
+	}
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,229 @@
+#include "WorkerProcesses.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fstream>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using std::vector;
+
+#ifdef _WIN32
+
+vector<vector<std::byte>> runWorkerProcesses(int, const std::function<vector<std::byte>(int)>&)
+{
+	throw std::runtime_error("runWorkerProcesses: worker processes need fork(), which is not available on Windows");
+}
+
+#else
+
+namespace
+{
+	// Threads of this process, or 0 where that is not known (systems without /proc/self/status):
+	int threadCount()
+	{
+		std::ifstream status("/proc/self/status");
+		std::string line;
+		while (std::getline(status, line))
+		{
+			if (line.compare(0, 8, "Threads:") == 0)
+			{
+				return std::stoi(line.substr(8));
+			}
+		}
+		return 0;
+	}
+
+	// Writes or reads exactly size bytes, retrying after partial transfers and signals:
+	bool writeAll(int fd, const std::byte* data, std::size_t size)
+	{
+		while (size > 0)
+		{
+			ssize_t n = write(fd, data, size);
+			if (n < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (n <= 0)
+			{
+				return false;
+			}
+			data += n;
+			size -= static_cast<std::size_t>(n);
+		}
+		return true;
+	}
+
+	bool readAll(int fd, std::byte* data, std::size_t size)
+	{
+		while (size > 0)
+		{
+			ssize_t n = read(fd, data, size);
+			if (n < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (n <= 0)
+			{
+				return false;
+			}
+			data += n;
+			size -= static_cast<std::size_t>(n);
+		}
+		return true;
+	}
+
+	// A child sends one record:  a tag, the size of the body, and the body, which is either
+	// the result of its work or the message of the exception that the work threw.
+	constexpr std::uint8_t resultRecord = 0;
+	constexpr std::uint8_t errorRecord = 1;
+
+	bool writeRecord(int fd, std::uint8_t tag, const vector<std::byte>& body)
+	{
+		std::uint64_t size = body.size();
+		return writeAll(fd, reinterpret_cast<const std::byte*>(&tag), sizeof(tag)) &&
+			writeAll(fd, reinterpret_cast<const std::byte*>(&size), sizeof(size)) &&
+			writeAll(fd, body.data(), body.size());
+	}
+
+	void writeError(int fd, const char* message)
+	{
+		const std::byte* text = reinterpret_cast<const std::byte*>(message);
+		writeRecord(fd, errorRecord, vector<std::byte>(text, text + std::char_traits<char>::length(message)));
+	}
+}
+
+vector<vector<std::byte>> runWorkerProcesses(int numWorkers, const std::function<vector<std::byte>(int)>& work)
+{
+	// A child has only the forking thread, and would deadlock on any lock that another thread
+	// (of a thread pool, or of TBB) held at the fork:
+	int numThreads = threadCount();
+	if (numThreads > 1)
+	{
+		throw std::runtime_error("runWorkerProcesses: cannot fork while " + std::to_string(numThreads)
+			+ " threads are running");
+	}
+
+	vector<pid_t> children;
+	vector<int> pipes;		// Read end of each child's pipe
+	bool started = true;
+
+	for (int w = 0; w < numWorkers; ++w)
+	{
+		int fds[2];
+		if (pipe(fds) != 0)
+		{
+			started = false;
+			break;
+		}
+		pid_t pid = fork();
+		if (pid < 0)
+		{
+			close(fds[0]);
+			close(fds[1]);
+			started = false;
+			break;
+		}
+		if (pid == 0)
+		{
+			// Child:  one record, then exit without unwinding the caller's state.
+			close(fds[0]);
+			for (int fd : pipes)
+			{
+				close(fd);
+			}
+			int status = 1;
+			try
+			{
+				if (writeRecord(fds[1], resultRecord, work(w)))
+				{
+					status = 0;
+				}
+			}
+			catch (const std::exception& e)
+			{
+				writeError(fds[1], e.what());
+			}
+			catch (...)
+			{
+				writeError(fds[1], "unknown exception");
+			}
+			close(fds[1]);
+			_exit(status);
+		}
+		close(fds[1]);
+		children.push_back(pid);
+		pipes.push_back(fds[0]);
+	}
+
+	// Each pipe is drained in turn; a child blocked on a full pipe waits until its turn.
+	vector<vector<std::byte>> results(children.size());
+	int failedWorker = -1;
+	std::string failure = "failed";
+	for (std::size_t w = 0; w < children.size(); ++w)
+	{
+		std::uint8_t tag = 0;
+		std::uint64_t size = 0;
+		bool ok = readAll(pipes[w], reinterpret_cast<std::byte*>(&tag), sizeof(tag)) &&
+			readAll(pipes[w], reinterpret_cast<std::byte*>(&size), sizeof(size));
+		if (ok)
+		{
+			results[w].resize(size);
+			ok = readAll(pipes[w], results[w].data(), size);
+		}
+		close(pipes[w]);
+		if ((!ok || tag != resultRecord) && failedWorker < 0)
+		{
+			failedWorker = static_cast<int>(w);
+			if (ok)
+			{
+				failure.assign(reinterpret_cast<const char*>(results[w].data()), results[w].size());
+			}
+		}
+	}
+
+	for (std::size_t w = 0; w < children.size(); ++w)
+	{
+		int status = 0;
+		while (waitpid(children[w], &status, 0) < 0 && errno == EINTR)
+		{
+		}
+		if (!(WIFEXITED(status) && WEXITSTATUS(status) == 0) && failedWorker < 0)
+		{
+			failedWorker = static_cast<int>(w);
+		}
+	}
+
+	if (!started)
+	{
+		throw std::runtime_error("runWorkerProcesses: could not start worker " + std::to_string(children.size()));
+	}
+	if (failedWorker >= 0)
+	{
+		throw std::runtime_error("runWorkerProcesses: worker " + std::to_string(failedWorker) + ": " + failure);
+	}
+	return results;
+}
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
@@ -0,0 +1,39 @@
+#ifndef WORKER_PROCESSES_H
+#define WORKER_PROCESSES_H
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+
+// Runs work(w) for w = 0, 1, ..., numWorkers - 1, each in a child process forked from the
+// caller, and returns the bytes that each child's call produced, in worker order.  The
+// children start with a copy of the caller's memory, so work can read any state set up
+// beforehand; their results come back through one pipe per child.  A child ends with
+// _exit(.), so no destructors or atexit handlers of the caller run twice.
+//
+// The caller must not be running other threads:  only the forking thread exists in a child,
+// and locks held by the others would never be released there.  Threads still alive include
+// those of ThreadPool::shared(.), which lives until exit, and of a pricer's own pool.  Where
+// the threads can be counted (Linux), a multi-threaded caller is refused.  Throws
+// std::runtime_error then, if a child fails (its work threw, in which case the message of
+// its exception is passed on, or it died), and on platforms without fork(.) (Windows).
+std::vector<std::vector<std::byte>> runWorkerProcesses(int numWorkers,
+	const std::function<std::vector<std::byte>(int worker)>& work);
+
+#endif
+
+/*
+	Copyright 2019 Daniel Hanson
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/